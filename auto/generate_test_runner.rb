@@ -42,7 +42,8 @@ class UnityTestRunnerGenerator
       main_export_decl: '',
       cmdline_args: false,
       omit_begin_end: false,
-      use_param_tests: false
+      use_param_tests: false,
+      param_tables: false
     }
   end
 
@@ -64,6 +65,7 @@ class UnityTestRunnerGenerator
     source = File.read(input_file)
     source = source.force_encoding('ISO-8859-1').encode('utf-8', replace: nil)
     tests = find_tests(source)
+    tests = order_by_dependencies(input_file, tests)
     headers = find_includes(source)
     testfile_includes = (headers[:local] + headers[:system])
     used_mocks = find_mocks(testfile_includes)
@@ -82,10 +84,59 @@ class UnityTestRunnerGenerator
     all_files_used.uniq
   end
 
+  # Builds one runner for many test files: a suite runner per file, each
+  # compiled with its test file and naming its functions apart, and a main in
+  # output_file that runs the suites in turn. The test files themselves are
+  # included by their suite runners, so they are not compiled on their own.
+  def run_aggregate(input_files, output_file)
+    suites = input_files.map do |input_file|
+      base = File.basename(input_file, '.c')
+      { input: input_file,
+        prefix: TypeSanitizer.sanitize_c_identifier(base),
+        runner: File.join(File.dirname(output_file), "#{base}_Runner.c") }
+    end
+    clashes = suites.group_by { |suite| suite[:prefix] }.select { |_, same| same.size > 1 }.keys
+    raise "Test files must have distinct names to share a runner, but #{clashes.join(', ')} do not" unless clashes.empty?
+
+    # tags are named once for the whole runner, so every suite numbers them alike,
+    # and tests that depend on others in any file keep the whole run in order
+    tests = input_files.flat_map do |input_file|
+      find_tests(File.read(input_file).force_encoding('ISO-8859-1').encode('utf-8', replace: nil))
+    end
+    tag_names = tests.flat_map { |test| test[:tags] || [] }.uniq
+    raise "Tests in #{input_files.join(', ')} use #{tag_names.size} tags, but at most 32 are supported" if tag_names.size > 32
+
+    all_files_used = suites.flat_map do |suite|
+      options = @options.merge(suite_prefix: suite[:prefix], tag_names: tag_names)
+      UnityTestRunnerGenerator.new(options).run(suite[:input], suite[:runner])
+    end
+    File.open(output_file, 'w') do |output|
+      create_aggregate_main(output, output_file, suites, tag_names, tests.any? { |test| !(test[:depends_on] || []).empty? })
+    end
+    (all_files_used + [output_file]).uniq
+  end
+
   def generate(input_file, output_file, tests, used_mocks, testfile_includes)
+    # each tag gets a bit of the UNITY_UINT32 runners select tests by
+    @tag_names = @options[:tag_names] || tests.flat_map { |test| test[:tags] || [] }.uniq
+    raise "Tests in #{input_file} use #{@tag_names.size} tags, but at most 32 are supported" if @tag_names.size > 32
+
+    # run_test reports whether each of these failed, so the tests depending on it can be skipped
+    @prerequisites = tests.flat_map { |test| test[:depends_on] || [] }.uniq
+
+    # with :param_tables, parameterized tests run their cases from a table of arguments, which main tells them the row of
+    @param_tables = tests.any? { |test| param_table?(test) }
+
+    # and tests with a TEST_CASE_SOURCE run each case its provider makes, one at a time
+    @case_sources = tests.any? { |test| test[:case_source] }
+
     File.open(output_file, 'w') do |output|
       create_header(output, used_mocks, testfile_includes)
-      create_externs(output, tests, used_mocks)
+      if @options[:suite_prefix]
+        create_suite_scope(output, input_file, output_file, tests)
+      else
+        create_externs(output, tests, used_mocks)
+      end
       create_mock_management(output, used_mocks)
       create_setup(output)
       create_teardown(output)
@@ -128,20 +179,31 @@ class UnityTestRunnerGenerator
 
     lines.each_with_index do |line, _index|
       # find tests
-      next unless line =~ /^((?:\s*TEST_CASE\s*\(.*?\)\s*)*)\s*void\s+((?:#{@options[:test_prefix]}).*)\s*\(\s*(.*)\s*\)/m
+      next unless line =~ /^((?:\s*(?:TEST_CASE_SOURCE|TEST_CASE|TEST_RANGE|TEST_MATRIX|TEST_TAGS|TEST_DEPENDS_ON)\s*\(.*?\)\s*)*)\s*void\s+((?:#{@options[:test_prefix]}).*)\s*\(\s*(.*)\s*\)/m
 
       arguments = Regexp.last_match(1)
       name = Regexp.last_match(2)
       call = Regexp.last_match(3)
       params = Regexp.last_match(4)
       args = nil
+      case_source = nil
 
       if @options[:use_param_tests] && !arguments.empty?
         args = []
-        arguments.scan(/\s*TEST_CASE\s*\((.*)\)\s*$/) { |a| args << a[0] }
+        arguments.scan(/\s*(TEST_CASE|TEST_RANGE|TEST_MATRIX)\s*\((.*)\)\s*$/) do |annotation, list|
+          args.concat(test_case_args(name, annotation, list))
+        end
+        case_sources = annotation_list(arguments, 'TEST_CASE_SOURCE')
+        raise "#{name} has more than one TEST_CASE_SOURCE" if case_sources.size > 1
+        raise "#{name} has a TEST_CASE_SOURCE, so it cannot have other test cases too" if case_sources.any? && args.any?
+
+        case_source = case_sources.first
       end
 
-      tests_and_line_numbers << { test: name, args: args, call: call, params: params, line_number: 0 }
+      tags = annotation_list(arguments, 'TEST_TAGS')
+      depends_on = annotation_list(arguments, 'TEST_DEPENDS_ON')
+
+      tests_and_line_numbers << { test: name, args: args, case_source: case_source, call: call, params: params, tags: tags, depends_on: depends_on, line_number: 0 }
     end
 
     tests_and_line_numbers.uniq! { |v| v[:test] }
@@ -162,6 +224,91 @@ class UnityTestRunnerGenerator
     tests_and_line_numbers
   end
 
+  # The argument lists a TEST_CASE, TEST_RANGE or TEST_MATRIX runs a test with
+  def test_case_args(name, annotation, list)
+    return [list] if annotation == 'TEST_CASE'
+
+    values = if annotation == 'TEST_MATRIX' || list.strip.start_with?('[')
+               split_list(list).map do |item|
+                 raise "#{annotation} for #{name} wants a [list] for each argument, not #{item}" unless item =~ /\A\[(.*)\]\z/m
+
+                 annotation == 'TEST_RANGE' ? range_values(name, Regexp.last_match(1)) : split_list(Regexp.last_match(1))
+               end
+             else
+               [range_values(name, list)]
+             end
+    values.first.product(*values.drop(1)).map { |combination| combination.join(', ') }
+  end
+
+  # The values from start to end, inclusive, in steps of step
+  def range_values(name, range)
+    start, stop, step = split_list(range)
+    raise "TEST_RANGE for #{name} wants start, end and step, not #{range.strip}" if step.nil? || split_list(range).size != 3
+
+    numbers = [start, stop, step].map { |number| number =~ /\A[-+]?\d+\z/ ? Integer(number, 10) : Float(number) }
+    raise "TEST_RANGE for #{name} never gets from #{start} to #{stop} in steps of #{step}" if numbers[2].zero? || (numbers[1] - numbers[0]) * numbers[2] < 0
+
+    # floating point steps are rounded to the places they were written with, so 0.1 steps give 0.3, not 0.30000000000000004
+    places = [start, stop, step].map { |number| number =~ /[eE]/ ? 15 : number[/\.(\d+)/, 1].to_s.size }.max
+    count = ((numbers[1] - numbers[0]) / numbers[2].to_f + 1e-9).floor + 1
+    Array.new(count) { |i| (numbers[0] + i * numbers[2]).round(places).to_s }
+  rescue ArgumentError
+    raise "TEST_RANGE for #{name} wants numbers, not #{range.strip}"
+  end
+
+  # Splits a list at the commas that are not inside brackets, parentheses or quotes
+  def split_list(list)
+    items = ['']
+    depth = 0
+    quote = nil
+    escaped = false
+    list.each_char do |c|
+      if escaped
+        escaped = false
+      elsif quote
+        escaped = (c == '\\')
+        quote = nil if c == quote
+      elsif c == '"' || c == "'"
+        quote = c
+      elsif '([{'.include?(c)
+        depth += 1
+      elsif ')]}'.include?(c)
+        depth -= 1
+      elsif c == ',' && depth.zero?
+        items << ''
+        next
+      end
+      items.last << c
+    end
+    items.map(&:strip).reject(&:empty?)
+  end
+
+  def annotation_list(arguments, annotation)
+    lists = arguments.scan(/#{annotation}\s*\((.*?)\)/).flatten
+    lists.flat_map { |list| list.delete('"').split(/[\s,]+/) }.reject(&:empty?).uniq
+  end
+
+  # Moves each test after the tests it depends on, otherwise keeping the order of the file
+  def order_by_dependencies(input_file, tests)
+    by_name = tests.map { |test| [test[:test], test] }.to_h
+    ordered = []
+    placed = {}
+    place = lambda do |test, chain|
+      return if placed[test[:test]]
+      raise "Tests in #{input_file} depend on each other in a cycle: #{(chain + [test[:test]]).join(' -> ')}" if chain.include?(test[:test])
+
+      test[:depends_on].each do |prerequisite|
+        raise "#{test[:test]} in #{input_file} depends on #{prerequisite}, which is not a test there" unless by_name[prerequisite]
+
+        place.call(by_name[prerequisite], chain + [test[:test]])
+      end
+      placed[test[:test]] = true
+      ordered << test
+    end
+    tests.each { |test| place.call(test, []) }
+    ordered
+  end
+
   def find_includes(source)
     # remove comments (block and line, in three steps to ensure correct precedence)
     source.gsub!(/\/\/(?:.+\/\*|\*(?:$|[^\/])).*$/, '')  # remove line comments that comment out the start of blocks
@@ -236,6 +383,26 @@ class UnityTestRunnerGenerator
     output.puts('')
   end
 
+  # Suites sharing a runner each include their test file, with every name it
+  # shares with the others given the suite's prefix, so each keeps its own.
+  def create_suite_scope(output, input_file, output_file, tests)
+    prefix = @options[:suite_prefix]
+    names = [@options[:setup_name], @options[:teardown_name], 'suiteSetUp', 'suiteTearDown',
+             @options[:test_reset_name], @options[:test_verify_name]] + tests.map { |test| test[:test] } +
+            tests.map { |test| test[:case_source] }.compact
+    output.puts("\n/*=======Names This Suite Keeps To Itself=====*/")
+    names.uniq.each { |name| output.puts("#define #{name} #{prefix}_#{name}") }
+    create_externs(output, tests, nil)
+    output.puts('void suiteSetUp(void);')
+    output.puts('int suiteTearDown(int num_failures);')
+    output.puts("void #{@options[:test_reset_name]}(void);")
+    output.puts("void #{@options[:test_verify_name]}(void);")
+    require 'pathname'
+    runner_dir = Pathname.new(File.expand_path(File.dirname(output_file)))
+    test_file = Pathname.new(File.expand_path(input_file)).relative_path_from(runner_dir)
+    output.puts("#include \"#{test_file}\"")
+  end
+
   def create_mock_management(output, mock_headers)
     output.puts("\n/*=======Mock Management=====*/")
     output.puts('static void CMock_Init(void)')
@@ -333,44 +500,166 @@ class UnityTestRunnerGenerator
     return unless @options[:use_param_tests]
 
     output.puts("\n/*=======Parameterized Test Wrappers=====*/")
+    output.puts('static unsigned int runner_case;') if @param_tables
+    output.puts('static UNITY_TEST_CASE_T runner_source_case;') if @case_sources
     tests.each do |test|
-      next if test[:args].nil? || test[:args].empty?
-
-      test[:args].each.with_index(1) do |args, idx|
-        output.puts("static void runner_args#{idx}_#{test[:test]}(void)")
+      if test[:case_source]
+        output.puts("#ifdef __cplusplus\nextern \"C\"\n#endif") if @options[:externc]
+        output.puts("int #{test[:case_source]}(UNITY_TEST_CASE_T* test_case);")
+        output.puts("static void runner_source_#{test[:test]}(void)")
         output.puts('{')
-        output.puts("    #{test[:test]}(#{args});")
+        output.puts("    #{test[:test]}(&runner_source_case);")
         output.puts("}\n")
       end
+      next if test[:args].nil? || test[:args].empty?
+
+      unless param_table?(test)
+        # each case gets a wrapper that passes its arguments as written
+        test[:args].each.with_index(1) do |args, idx|
+          output.puts("static void runner_args#{idx}_#{test[:test]}(void)")
+          output.puts('{')
+          output.puts("    #{test[:test]}(#{args});")
+          output.puts("}\n")
+        end
+        next
+      end
+
+      fields = param_fields(test)
+      output.puts('static const struct')
+      output.puts('{')
+      fields.each { |field| output.puts("  #{field[:decl]};") }
+      output.puts("} runner_args_#{test[:test]}[#{test[:args].size}] =")
+      output.puts('{')
+      test[:args].each { |args| output.puts("  { #{args} },") }
+      output.puts('};')
+      output.puts("static void runner_cases_#{test[:test]}(void)")
+      output.puts('{')
+      output.puts("    #{test[:test]}(#{fields.map { |field| "runner_args_#{test[:test]}[runner_case].#{field[:name]}" }.join(', ')});")
+      output.puts("}\n")
     end
   end
 
+  # Only with :param_tables, whose static tables need constant arguments. A case
+  # calling a function is clearly not one, so its test keeps the wrappers.
+  def param_table?(test)
+    return false unless @options[:use_param_tests] && @options[:param_tables]
+    return false if test[:args].nil? || test[:args].empty?
+
+    test[:args].none? { |args| args =~ /\w\s*\(/ && args !~ /\A\s*sizeof\s*\(/ } && !param_fields(test).nil?
+  end
+
+  # The declaration and name of each parameter of a test, or nil if one cannot
+  # be a field of a struct, such as an array, a function pointer or a reference
+  def param_fields(test)
+    params = split_list(test[:call].to_s)
+    return nil if params.empty? || params == ['void']
+
+    fields = params.map do |param|
+      param = param.gsub(/\s+/, ' ')
+      next nil if param =~ /[\[\]()&]|\.\.\./ || param !~ /\A(.*\w.*[\s\*])([A-Za-z_]\w*)\z/
+
+      { decl: param, name: Regexp.last_match(2) }
+    end
+    fields.include?(nil) ? nil : fields
+  end
+
+  # one entry per test or test case, which main runs in a loop
+  def runner_tests(tests)
+    tests.flat_map do |test|
+      if test[:case_source]
+        [{ func: "runner_source_#{test[:test]}", name: test[:test].dump, test: test, row: 0, source: test[:case_source] }]
+      elsif (!@options[:use_param_tests]) || test[:args].nil? || test[:args].empty?
+        [{ func: test[:test], name: test[:test].dump, test: test, row: 0 }]
+      elsif param_table?(test)
+        test[:args].each_with_index.map do |args, row|
+          { func: "runner_cases_#{test[:test]}", name: "#{test[:test]}(#{args})".dump, test: test, row: row }
+        end
+      else
+        test[:args].each.with_index(1).map do |args, idx|
+          { func: "runner_args#{idx}_#{test[:test]}", name: "#{test[:test]}(#{args})".dump, test: test, row: 0 }
+        end
+      end
+    end
+  end
+
+  def create_test_table(output, entries)
+    return if entries.empty?
+
+    depends_on = [-1]
+    output.puts("\n/*=======Test Table=====*/")
+    output.puts('static const struct')
+    output.puts('{')
+    output.puts('  UnityTestFunction func;')
+    output.puts('  const char* name;')
+    output.puts('  int line_num;')
+    output.puts('  UNITY_UINT32 tags;') if @options[:cmdline_args]
+    output.puts('  unsigned int row;') if @param_tables
+    output.puts('  UnityTestCaseSource source;') if @case_sources
+    unless @prerequisites.empty?
+      output.puts('  int prerequisite;')
+      output.puts('  int depends_on;')
+    end
+    output.puts("} runner_tests[#{entries.size}] =")
+    output.puts('{')
+    entries.each do |entry|
+      test = entry[:test]
+      fields = [entry[:func], entry[:name], test[:line_number]]
+      fields << tag_mask(test) if @options[:cmdline_args]
+      fields << entry[:row] if @param_tables
+      fields << (entry[:source] || 'NULL') if @case_sources
+      unless @prerequisites.empty?
+        fields << (@prerequisites.index(test[:test]) || -1)
+        if test[:depends_on].empty?
+          fields << 0
+        else
+          fields << depends_on.size
+          depends_on += test[:depends_on].map { |name| @prerequisites.index(name) } + [-1]
+        end
+      end
+      output.puts("  { #{fields.join(', ')} },")
+    end
+    output.puts('};')
+    return if @prerequisites.empty?
+
+    # each test's prerequisites, as a list ending in -1 starting at its depends_on
+    output.puts("static const int runner_depends_on[] = { #{depends_on.join(', ')} };")
+    output.puts("static const char* const prerequisite_names[] = { #{@prerequisites.map(&:dump).join(', ')} };")
+  end
+
   def create_main(output, filename, tests, used_mocks)
+    entries = runner_tests(tests)
+    create_test_table(output, entries)
+    return create_suite_main(output, filename, entries, used_mocks) if @options[:suite_prefix]
+
     output.puts("\n\n/*=======MAIN=====*/")
+    output.puts("static int prerequisite_failed[#{@prerequisites.size}];") unless @prerequisites.empty?
     main_name = @options[:main_name].to_sym == :auto ? "main_#{filename.gsub('.c', '')}" : (@options[:main_name]).to_s
     if @options[:cmdline_args]
+      unless @tag_names.empty?
+        output.puts("static const char* const tag_names[] = { #{@tag_names.map(&:dump).join(', ')} };")
+      end
       if main_name != 'main'
         output.puts("#{@options[:main_export_decl]} int #{main_name}(int argc, char** argv);")
       end
       output.puts("#{@options[:main_export_decl]} int #{main_name}(int argc, char** argv)")
       output.puts('{')
-      output.puts('  int parse_status = UnityParseOptions(argc, argv);')
+      output.puts('  unsigned int i;') unless entries.empty?
+      if @tag_names.empty? && @prerequisites.empty?
+        output.puts('  int parse_status = UnityParseOptions(argc, argv);')
+      else
+        output.puts('  int parse_status;')
+        output.puts("  UnitySetTagNames(tag_names, #{@tag_names.size});") unless @tag_names.empty?
+        output.puts('  UNITY_RUN_STATE_KEEP_ORDER();') unless @prerequisites.empty?
+        output.puts('  parse_status = UnityParseOptions(argc, argv);')
+      end
       output.puts('  if (parse_status != 0)')
       output.puts('  {')
       output.puts('    if (parse_status < 0)')
       output.puts('    {')
       output.puts("      UnityPrint(\"#{filename.gsub('.c', '')}.\");")
       output.puts('      UNITY_PRINT_EOL();')
-      tests.each do |test|
-        if (!@options[:use_param_tests]) || test[:args].nil? || test[:args].empty?
-          output.puts("      UnityPrint(\"  #{test[:test]}\");")
-          output.puts('      UNITY_PRINT_EOL();')
-        else
-          test[:args].each do |args|
-            output.puts("      UnityPrint(\"  #{test[:test]}(#{args})\");")
-            output.puts('      UNITY_PRINT_EOL();')
-          end
-        end
+      unless entries.empty?
+        create_list_loop(output, entries, '      ')
       end
       output.puts('      return 0;')
       output.puts('    }')
@@ -383,6 +672,7 @@ class UnityTestRunnerGenerator
       end
       output.puts("#{main_return} #{main_name}(void)")
       output.puts('{')
+      output.puts('  unsigned int i;') unless entries.empty?
     end
     output.puts('  suiteSetUp();') if @options[:has_suite_setup]
     if @options[:omit_begin_end]
@@ -390,17 +680,15 @@ class UnityTestRunnerGenerator
     else
       output.puts("  UnityBegin(\"#{filename.gsub(/\\/, '\\\\\\')}\");")
     end
-    tests.each do |test|
-      if (!@options[:use_param_tests]) || test[:args].nil? || test[:args].empty?
-        output.puts("  run_test(#{test[:test]}, \"#{test[:test]}\", #{test[:line_number]});")
-      else
-        test[:args].each.with_index(1) do |args, idx|
-          wrapper = "runner_args#{idx}_#{test[:test]}"
-          testname = "#{test[:test]}(#{args})".dump
-          output.puts("  run_test(#{wrapper}, #{testname}, #{test[:line_number]});")
-        end
-      end
+    create_prerequisites_reset(output)
+    # command line options such as --fail-first may ask for more than one pass
+    indent = @options[:cmdline_args] ? '    ' : '  '
+    if @options[:cmdline_args]
+      output.puts('  do')
+      output.puts('  {')
     end
+    create_test_loop(output, entries, indent) unless entries.empty?
+    output.puts('  } while (UNITY_RUN_STATE_NEXT_PASS());') if @options[:cmdline_args]
     output.puts
     output.puts('  CMock_Guts_MemFreeFinal();') unless used_mocks.empty?
     if @options[:has_suite_teardown]
@@ -415,6 +703,170 @@ class UnityTestRunnerGenerator
     output.puts('}')
   end
 
+  # A suite of an aggregate runner lists or runs its tests when main asks it to
+  def create_suite_main(output, filename, entries, used_mocks)
+    suite_name = "unity_suite_#{@options[:suite_prefix]}"
+    output.puts("\n\n/*=======Suite=====*/")
+    output.puts("static int prerequisite_failed[#{@prerequisites.size}];") unless @prerequisites.empty?
+    output.puts("void #{suite_name}(int list);")
+    output.puts("void #{suite_name}(int list)")
+    output.puts('{')
+    output.puts('  unsigned int i;') unless entries.empty?
+    output.puts('  if (list)')
+    output.puts('  {')
+    output.puts("    UnityPrint(\"#{filename.gsub('.c', '')}.\");")
+    output.puts('    UNITY_PRINT_EOL();')
+    unless entries.empty?
+      create_list_loop(output, entries, '    ')
+    end
+    output.puts('    return;')
+    output.puts('  }')
+    output.puts('  suiteSetUp();') if @options[:has_suite_setup]
+    output.puts("  UnitySetTestFile(\"#{filename.gsub(/\\/, '\\\\\\')}\");")
+    create_prerequisites_reset(output)
+    create_test_loop(output, entries, '  ') unless entries.empty?
+    output.puts('  CMock_Guts_MemFreeFinal();') unless used_mocks.empty?
+    output.puts('  (void)suiteTearDown((int)Unity.TestFailures);') if @options[:has_suite_teardown]
+    output.puts('}')
+  end
+
+  def create_aggregate_main(output, filename, suites, tag_names, keep_order)
+    main_name = @options[:main_name].to_sym == :auto ? "main_#{File.basename(filename, '.c')}" : @options[:main_name].to_s
+    output.puts('/* AUTOGENERATED FILE. DO NOT EDIT. */')
+    output.puts("\n/*=======Automagically Detected Files To Include=====*/")
+    output.puts("#include \"#{@options[:framework]}.h\"")
+    output.puts("\n/*=======Suites This Runner Calls=====*/")
+    suites.each { |suite| output.puts("void unity_suite_#{suite[:prefix]}(int list);") }
+    output.puts("static void (* const runner_suites[#{suites.size}])(int list) =")
+    output.puts('{')
+    suites.each { |suite| output.puts("  unity_suite_#{suite[:prefix]},") }
+    output.puts('};')
+    output.puts("\n/*=======Setup And Teardown For RUN_TEST (stubs)=====*/")
+    output.puts('void setUp(void) {}')
+    output.puts('void tearDown(void) {}')
+    output.puts("\n\n/*=======MAIN=====*/")
+    if @options[:cmdline_args]
+      output.puts("static const char* const tag_names[] = { #{tag_names.map(&:dump).join(', ')} };") unless tag_names.empty?
+      output.puts("#{@options[:main_export_decl]} int #{main_name}(int argc, char** argv);") if main_name != 'main'
+      output.puts("#{@options[:main_export_decl]} int #{main_name}(int argc, char** argv)")
+      output.puts('{')
+      output.puts('  unsigned int i;')
+      output.puts('  int parse_status;')
+      output.puts("  UnitySetTagNames(tag_names, #{tag_names.size});") unless tag_names.empty?
+      output.puts('  UNITY_RUN_STATE_KEEP_ORDER();') if keep_order
+      output.puts('  parse_status = UnityParseOptions(argc, argv);')
+      output.puts('  if (parse_status != 0)')
+      output.puts('  {')
+      output.puts('    if (parse_status < 0)')
+      output.puts('    {')
+      output.puts("      for (i = 0; i < #{suites.size}; i++)")
+      output.puts('        runner_suites[i](1);')
+      output.puts('      return 0;')
+      output.puts('    }')
+      output.puts('    return parse_status;')
+      output.puts('  }')
+    else
+      output.puts("#{@options[:main_export_decl]} int #{main_name}(void);") if main_name != 'main'
+      output.puts("#{@options[:main_export_decl]} int #{main_name}(void)")
+      output.puts('{')
+      output.puts('  unsigned int i;')
+    end
+    output.puts("  UnityBegin(\"#{filename.gsub(/\\/, '\\\\\\')}\");")
+    indent = @options[:cmdline_args] ? '    ' : '  '
+    if @options[:cmdline_args]
+      output.puts('  do')
+      output.puts('  {')
+    end
+    output.puts("#{indent}for (i = 0; i < #{suites.size}; i++)")
+    output.puts("#{indent}  runner_suites[i](0);")
+    output.puts('  } while (UNITY_RUN_STATE_NEXT_PASS());') if @options[:cmdline_args]
+    output.puts('  return UnityEnd();')
+    output.puts('}')
+  end
+
+  # A host keeps a runner loaded between runs, so no failure outlasts the run it happened in
+  def create_prerequisites_reset(output)
+    return if @prerequisites.empty?
+
+    output.puts("  for (i = 0; i < #{@prerequisites.size}; i++)")
+    output.puts('    prerequisite_failed[i] = 0;')
+  end
+
+  def create_test_loop(output, entries, indent)
+    name = @case_sources ? 'name' : 'runner_tests[i].name'
+    args = "runner_tests[i].func, #{name}, runner_tests[i].line_num"
+    args += ', runner_tests[i].tags' if @options[:cmdline_args]
+    output.puts("#{indent}for (i = 0; i < #{entries.size}; i++)")
+    if @prerequisites.empty? && !@param_tables && !@case_sources
+      output.puts("#{indent}  run_test(#{args});")
+      return
+    end
+
+    output.puts("#{indent}{")
+    unless @prerequisites.empty?
+      output.puts("#{indent}  const char* blocked_by = NULL;")
+      output.puts("#{indent}  int d;")
+      output.puts("#{indent}  int failed;")
+    end
+    create_case_source_start(output, "#{indent}  ") if @case_sources
+    output.puts("#{indent}  runner_case = runner_tests[i].row;") if @param_tables
+    unless @prerequisites.empty?
+      output.puts("#{indent}  for (d = runner_tests[i].depends_on; runner_depends_on[d] >= 0; d++)")
+      output.puts("#{indent}  {")
+      output.puts("#{indent}    if ((blocked_by == NULL) && prerequisite_failed[runner_depends_on[d]])")
+      output.puts("#{indent}      blocked_by = prerequisite_names[runner_depends_on[d]];")
+      output.puts("#{indent}  }")
+    end
+    run = if @prerequisites.empty?
+            ["run_test(#{args});"]
+          else
+            ["failed = run_test(#{args}, blocked_by);",
+             'if (runner_tests[i].prerequisite >= 0)',
+             '  prerequisite_failed[runner_tests[i].prerequisite] |= failed;']
+          end
+    create_case_source_loop(output, "#{indent}  ", run)
+    output.puts("#{indent}}")
+  end
+
+  # Lists every test, and every case of a test with a TEST_CASE_SOURCE
+  def create_list_loop(output, entries, indent)
+    name = @case_sources ? 'name' : 'runner_tests[i].name'
+    output.puts("#{indent}for (i = 0; i < #{entries.size}; i++)")
+    output.puts("#{indent}{")
+    create_case_source_start(output, "#{indent}  ") if @case_sources
+    create_case_source_loop(output, "#{indent}  ", ['UnityPrint("  ");', "UnityPrint(#{name});", 'UNITY_PRINT_EOL();'])
+    output.puts("#{indent}}")
+  end
+
+  def create_case_source_start(output, indent)
+    output.puts("#{indent}const char* name = runner_tests[i].name;")
+    output.puts("#{indent}UNITY_UINT32 c = 0;")
+  end
+
+  # Does the lines given once for a test, or once for each case its TEST_CASE_SOURCE makes, under the case's name
+  def create_case_source_loop(output, indent, lines)
+    unless @case_sources
+      lines.each { |line| output.puts("#{indent}#{line}") }
+      return
+    end
+
+    output.puts("#{indent}do")
+    output.puts("#{indent}{")
+    output.puts("#{indent}  if (runner_tests[i].source != NULL)")
+    output.puts("#{indent}  {")
+    output.puts("#{indent}    name = UnityTestCaseNext(runner_tests[i].source, &runner_source_case, runner_tests[i].name, c++);")
+    output.puts("#{indent}    if (name == NULL)")
+    output.puts("#{indent}      break;")
+    output.puts("#{indent}  }")
+    lines.each { |line| output.puts("#{indent}  #{line}") }
+    output.puts("#{indent}} while (runner_tests[i].source != NULL);")
+  end
+
+  def tag_mask(test)
+    mask = (test[:tags] || []).inject(0) { |bits, tag| bits | (1 << @tag_names.index(tag)) }
+    format('0x%08X', mask)
+  end
+
   def create_h_file(output, filename, tests, testfile_includes, used_mocks)
     filename = File.basename(filename).gsub(/[-\/\\\.\,\s]/, '_').upcase
     output.puts('/* AUTOGENERATED FILE. DO NOT EDIT. */')
@@ -483,11 +935,19 @@ if $0 == __FILE__
           '    --suite_setup=""      - code to execute for setup of entire suite',
           '    --suite_teardown=""   - code to execute for teardown of entire suite',
           '    --use_param_tests=1   - enable parameterized tests (disabled by default)',
+          '    --param_tables=1      - run constant test cases from a table (disabled by default)',
           '    --omit_begin_end=1    - omit calls to UnityBegin and UnityEnd (disabled by default)',
-          '    --header_file=""      - path/name of test header file to generate too'].join("\n")
+          '    --header_file=""      - path/name of test header file to generate too',
+          '    --aggregate=""        - generate this one runner for all the test files given'].join("\n")
     exit 1
   end
 
+  # with --aggregate=runner.c, every file left is a test file sharing that runner
+  if options[:aggregate]
+    UnityTestRunnerGenerator.new(options).run_aggregate(ARGV, options[:aggregate])
+    exit 0
+  end
+
   # create the default test runner name if not specified
   ARGV[1] = ARGV[0].gsub('.c', '_Runner.c') unless ARGV[1]
 
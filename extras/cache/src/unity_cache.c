@@ -0,0 +1,247 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+/* Fixtures that are slow to build are built once, written to a file, and
+ * mapped read-only by every later run, and by every process that asks for
+ * them at the same time. Each file starts with a header naming the version it
+ * was built for; the fixture follows at UNITY_CACHE_DATA, so it is as well
+ * aligned as anything malloc returns. */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "unity_cache.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define UNITY_CACHE_MAGIC "UNITYFC1"
+#define UNITY_CACHE_DATA  64
+
+typedef struct
+{
+    char Magic[8];
+    UNITY_UINT32 Version;
+    size_t Bytes;
+} UNITY_CACHE_HEADER_T;
+
+typedef struct
+{
+    char Key[UNITY_FIXTURE_CACHE_PATH_MAX];
+    UNITY_UINT32 Version;
+    void* Map;
+    size_t MapBytes;
+} UNITY_CACHE_ENTRY_T;
+
+static UNITY_CACHE_ENTRY_T entries[UNITY_FIXTURE_CACHE_MAX];
+
+static void cacheError(const char* problem, const char* key)
+{
+    UnityPrint("ERROR: ");
+    UnityPrint(problem);
+    UnityPrint(" ");
+    UnityPrint(key);
+    UNITY_PRINT_EOL();
+}
+
+/* Keys become file names, so they are kept to letters, digits and . _ - */
+static int validKey(const char* key)
+{
+    const char* c;
+
+    if ((key == NULL) || (key[0] == '\0') || (key[0] == '.'))
+        return 0;
+    for (c = key; *c != '\0'; c++)
+    {
+        if (!(((*c >= 'a') && (*c <= 'z')) || ((*c >= 'A') && (*c <= 'Z')) ||
+              ((*c >= '0') && (*c <= '9')) || (*c == '.') || (*c == '_') || (*c == '-')))
+            return 0;
+    }
+    return 1;
+}
+
+static int cachePath(char* path, size_t size, const char* key)
+{
+    const char* dir = getenv("UNITY_FIXTURE_CACHE_DIR");
+    int len;
+
+    if ((dir == NULL) || (dir[0] == '\0'))
+        dir = UNITY_FIXTURE_CACHE_DIR;
+    if ((mkdir(dir, 0777) != 0) && (errno != EEXIST))
+        return 1;
+    len = snprintf(path, size, "%s/%s.fixture", dir, key);
+    return ((len < 0) || ((size_t)len >= size)) ? 1 : 0;
+}
+
+/* Maps the file at path if it holds a whole fixture built for version */
+static void* mapFixture(const char* path, UNITY_UINT32 version, size_t* mapBytes)
+{
+    UNITY_CACHE_HEADER_T header;
+    struct stat built;
+    void* map;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+        return NULL;
+    if ((fstat(fd, &built) != 0) || (built.st_size < UNITY_CACHE_DATA))
+    {
+        close(fd);
+        return NULL;
+    }
+    map = mmap(NULL, (size_t)built.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return NULL;
+
+    memcpy(&header, map, sizeof(header));
+    if ((memcmp(header.Magic, UNITY_CACHE_MAGIC, sizeof(header.Magic)) != 0) ||
+        (header.Version != version) ||
+        (header.Bytes != (size_t)built.st_size - UNITY_CACHE_DATA))
+    {
+        munmap(map, (size_t)built.st_size);
+        return NULL;
+    }
+    *mapBytes = (size_t)built.st_size;
+    return map;
+}
+
+/* Builds the fixture into a file of its own and renames it into place, so
+ * other processes only ever see a whole fixture at path */
+static int buildFixture(const char* path, UNITY_UINT32 version, UnityFixtureCacheBuilder* build)
+{
+    char temp[UNITY_FIXTURE_CACHE_PATH_MAX + 24];
+    char block[UNITY_CACHE_DATA];
+    UNITY_CACHE_HEADER_T header;
+    FILE* out;
+    long end;
+    int failed;
+
+    snprintf(temp, sizeof(temp), "%s.%ld.tmp", path, (long)getpid());
+    out = fopen(temp, "wb");
+    if (out == NULL)
+        return 1;
+
+    memset(block, 0, sizeof(block));
+    failed = (fwrite(block, 1, sizeof(block), out) != sizeof(block));
+    if (!failed)
+        failed = build(out);
+    end = failed ? -1 : ftell(out);
+    if (end >= UNITY_CACHE_DATA)
+    {
+        memset(&header, 0, sizeof(header));
+        memcpy(header.Magic, UNITY_CACHE_MAGIC, sizeof(header.Magic));
+        header.Version = version;
+        header.Bytes = (size_t)(end - UNITY_CACHE_DATA);
+        memcpy(block, &header, sizeof(header));
+        failed = (fseek(out, 0, SEEK_SET) != 0) || (fwrite(block, 1, sizeof(block), out) != sizeof(block));
+    }
+    else
+    {
+        failed = 1;
+    }
+    if ((fclose(out) != 0) || failed || (rename(temp, path) != 0))
+    {
+        remove(temp);
+        return 1;
+    }
+    return 0;
+}
+
+static UNITY_CACHE_ENTRY_T* findEntry(const char* key)
+{
+    UNITY_CACHE_ENTRY_T* unused = NULL;
+    int i;
+
+    for (i = 0; i < UNITY_FIXTURE_CACHE_MAX; i++)
+    {
+        if (entries[i].Map == NULL)
+        {
+            if (unused == NULL)
+                unused = &entries[i];
+        }
+        else if (strcmp(entries[i].Key, key) == 0)
+        {
+            return &entries[i];
+        }
+    }
+    return unused;
+}
+
+const void* UnityFixtureCache_Get(const char* key,
+                                  UNITY_UINT32 version,
+                                  UnityFixtureCacheBuilder* build,
+                                  size_t* bytes)
+{
+    char path[UNITY_FIXTURE_CACHE_PATH_MAX];
+    UNITY_CACHE_ENTRY_T* entry;
+    void* map;
+    size_t mapBytes = 0;
+
+    if (!validKey(key) || (strlen(key) >= sizeof(entry->Key)))
+    {
+        cacheError("Invalid Fixture Cache Key", (key == NULL) ? "NULL" : key);
+        return NULL;
+    }
+    entry = findEntry(key);
+    if (entry == NULL)
+    {
+        cacheError("Too Many Cached Fixtures For", key);
+        return NULL;
+    }
+    if (entry->Map != NULL)
+    {
+        if (entry->Version == version)
+        {
+            *bytes = entry->MapBytes - UNITY_CACHE_DATA;
+            return (const char*)entry->Map + UNITY_CACHE_DATA;
+        }
+        munmap(entry->Map, entry->MapBytes);
+        entry->Map = NULL;
+    }
+
+    if (cachePath(path, sizeof(path), key) != 0)
+    {
+        cacheError("Cannot Make A Cache Path For", key);
+        return NULL;
+    }
+    map = mapFixture(path, version, &mapBytes);
+    if (map == NULL)
+    {
+        if (buildFixture(path, version, build) != 0)
+        {
+            cacheError("Failed To Build Fixture", key);
+            return NULL;
+        }
+        map = mapFixture(path, version, &mapBytes);
+        if (map == NULL)
+        {
+            cacheError("Cannot Map Fixture", path);
+            return NULL;
+        }
+    }
+
+    strcpy(entry->Key, key);
+    entry->Version = version;
+    entry->Map = map;
+    entry->MapBytes = mapBytes;
+    *bytes = mapBytes - UNITY_CACHE_DATA;
+    return (const char*)map + UNITY_CACHE_DATA;
+}
+
+void UnityFixtureCache_Close(void)
+{
+    int i;
+
+    for (i = 0; i < UNITY_FIXTURE_CACHE_MAX; i++)
+    {
+        if (entries[i].Map != NULL)
+            munmap(entries[i].Map, entries[i].MapBytes);
+        entries[i].Map = NULL;
+    }
+}
@@ -0,0 +1,53 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#ifndef UNITY_CACHE_H_
+#define UNITY_CACHE_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "unity.h"
+#include <stdio.h>
+
+/* Built fixtures are kept in this directory, one file per key. Setting the
+ * environment variable of the same name overrides it at run time. */
+#ifndef UNITY_FIXTURE_CACHE_DIR
+#define UNITY_FIXTURE_CACHE_DIR ".unity_cache"
+#endif
+
+/* How many fixtures stay mapped at once, and the longest path to one */
+#ifndef UNITY_FIXTURE_CACHE_MAX
+#define UNITY_FIXTURE_CACHE_MAX 16
+#endif
+
+#ifndef UNITY_FIXTURE_CACHE_PATH_MAX
+#define UNITY_FIXTURE_CACHE_PATH_MAX 512
+#endif
+
+/* Writes the fixture to out, returning 0 once it has all been written. The
+ * fixture is read back from wherever it is mapped, so it must not hold
+ * pointers; use offsets instead. */
+typedef int UnityFixtureCacheBuilder(FILE* out);
+
+/* Returns the fixture cached under key, mapped read-only, and its size in
+ * bytes. It is built first when there is none yet, or when the one there was
+ * built for another version. Returns NULL, and reports why, if that fails. */
+const void* UnityFixtureCache_Get(const char* key,
+                                  UNITY_UINT32 version,
+                                  UnityFixtureCacheBuilder* build,
+                                  size_t* bytes);
+
+/* Unmaps every fixture; pointers returned before are no longer valid */
+void UnityFixtureCache_Close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UNITY_CACHE_H_ */
@@ -0,0 +1,146 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#include "unity.h"
+#include "unity_cache.h"
+#include <stdio.h>
+
+/* This test module includes the following tests: */
+
+void test_FirstGetBuildsTheFixture(void);
+void test_LaterRunsMapTheBuiltFixture(void);
+void test_GetAgainReturnsTheSameMapping(void);
+void test_NewVersionRebuildsTheFixture(void);
+void test_DamagedFileIsRebuilt(void);
+void test_FailedBuildLeavesNoFixture(void);
+void test_InvalidKeysAreRejected(void);
+
+/* It makes use of the following features */
+void setUp(void);
+void tearDown(void);
+
+#define TABLE_KEY    "squares"
+#define TABLE_PATH   UNITY_FIXTURE_CACHE_DIR "/" TABLE_KEY ".fixture"
+#define TABLE_LENGTH 1000
+
+static size_t builds;
+
+static int buildSquares(FILE* out)
+{
+    UNITY_UINT32 i;
+
+    builds++;
+    for (i = 0; i < TABLE_LENGTH; i++)
+    {
+        UNITY_UINT32 square = i * i;
+        if (fwrite(&square, sizeof(square), 1, out) != 1)
+            return 1;
+    }
+    return 0;
+}
+
+static int buildNothing(FILE* out)
+{
+    (void)out;
+    builds++;
+    return 1;
+}
+
+static void verifySquares(UNITY_UINT32 version, size_t expectedBuilds)
+{
+    size_t bytes = 0;
+    const void* table = UnityFixtureCache_Get(TABLE_KEY, version, buildSquares, &bytes);
+    const UNITY_UINT32* squares = (const UNITY_UINT32*)table;
+
+    TEST_ASSERT_NOT_NULL(table);
+    TEST_ASSERT_EQUAL(TABLE_LENGTH * sizeof(UNITY_UINT32), bytes);
+    TEST_ASSERT_EQUAL_UINT32(0, squares[0]);
+    TEST_ASSERT_EQUAL_UINT32(998001, squares[TABLE_LENGTH - 1]);
+    TEST_ASSERT_EQUAL(expectedBuilds, builds);
+}
+
+/* Let's Go! */
+void setUp(void)
+{
+    builds = 0;
+    remove(TABLE_PATH);
+}
+
+void tearDown(void)
+{
+    UnityFixtureCache_Close();
+}
+
+void test_FirstGetBuildsTheFixture(void)
+{
+    verifySquares(1, 1);
+}
+
+void test_LaterRunsMapTheBuiltFixture(void)
+{
+    size_t bytes = 0;
+
+    TEST_ASSERT_NOT_NULL(UnityFixtureCache_Get(TABLE_KEY, 1, buildSquares, &bytes));
+    UnityFixtureCache_Close();
+
+    verifySquares(1, 1);
+}
+
+void test_GetAgainReturnsTheSameMapping(void)
+{
+    size_t bytes = 0;
+    const void* first = UnityFixtureCache_Get(TABLE_KEY, 1, buildSquares, &bytes);
+    const void* again = UnityFixtureCache_Get(TABLE_KEY, 1, buildSquares, &bytes);
+
+    TEST_ASSERT_EQUAL_PTR(first, again);
+    TEST_ASSERT_EQUAL(1, builds);
+}
+
+void test_NewVersionRebuildsTheFixture(void)
+{
+    size_t bytes = 0;
+
+    TEST_ASSERT_NOT_NULL(UnityFixtureCache_Get(TABLE_KEY, 1, buildSquares, &bytes));
+    UnityFixtureCache_Close();
+
+    verifySquares(2, 2);
+    verifySquares(1, 3);
+}
+
+void test_DamagedFileIsRebuilt(void)
+{
+    size_t bytes = 0;
+    FILE* damaged;
+
+    TEST_ASSERT_NOT_NULL(UnityFixtureCache_Get(TABLE_KEY, 1, buildSquares, &bytes));
+    UnityFixtureCache_Close();
+    damaged = fopen(TABLE_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(damaged);
+    fputs("not a fixture", damaged);
+    fclose(damaged);
+
+    verifySquares(1, 2);
+}
+
+void test_FailedBuildLeavesNoFixture(void)
+{
+    size_t bytes = 0;
+
+    TEST_ASSERT_NULL(UnityFixtureCache_Get(TABLE_KEY, 1, buildNothing, &bytes));
+    TEST_ASSERT_NULL(fopen(TABLE_PATH, "rb"));
+
+    verifySquares(1, 2);
+}
+
+void test_InvalidKeysAreRejected(void)
+{
+    size_t bytes = 0;
+
+    TEST_ASSERT_NULL(UnityFixtureCache_Get("../squares", 1, buildSquares, &bytes));
+    TEST_ASSERT_NULL(UnityFixtureCache_Get("", 1, buildSquares, &bytes));
+    TEST_ASSERT_NULL(UnityFixtureCache_Get(NULL, 1, buildSquares, &bytes));
+    TEST_ASSERT_EQUAL(0, builds);
+}
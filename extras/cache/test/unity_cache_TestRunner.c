@@ -0,0 +1,29 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#include "unity.h"
+#include "unity_cache.h"
+
+extern void test_FirstGetBuildsTheFixture(void);
+extern void test_LaterRunsMapTheBuiltFixture(void);
+extern void test_GetAgainReturnsTheSameMapping(void);
+extern void test_NewVersionRebuildsTheFixture(void);
+extern void test_DamagedFileIsRebuilt(void);
+extern void test_FailedBuildLeavesNoFixture(void);
+extern void test_InvalidKeysAreRejected(void);
+
+int main(void)
+{
+    UnityBegin("unity_cache_Test.c");
+    RUN_TEST(test_FirstGetBuildsTheFixture);
+    RUN_TEST(test_LaterRunsMapTheBuiltFixture);
+    RUN_TEST(test_GetAgainReturnsTheSameMapping);
+    RUN_TEST(test_NewVersionRebuildsTheFixture);
+    RUN_TEST(test_DamagedFileIsRebuilt);
+    RUN_TEST(test_FailedBuildLeavesNoFixture);
+    RUN_TEST(test_InvalidKeysAreRejected);
+    return UnityEnd();
+}
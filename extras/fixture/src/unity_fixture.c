@@ -8,6 +8,9 @@
 #include "unity_fixture.h"
 #include "unity_internals.h"
 #include <string.h>
+#ifndef UNITY_EXCLUDE_SHARD_ENV
+#include <stdlib.h>
+#endif
 
 struct UNITY_FIXTURE_T UnityFixture;
 
@@ -38,7 +41,11 @@ int UnityMain(int argc, const char* argv[], void (*runAllTests)(void))
     {
         UnityBegin(argv[0]);
         announceTestRun(r);
-        runAllTests();
+        do
+        {
+            runAllTests();
+            UnityConcludeFixtureGroup();
+        } while (UNITY_RUN_STATE_NEXT_PASS());
         if (!UnityFixture.Verbose) UNITY_PRINT_EOL();
         UnityEnd();
     }
@@ -58,25 +65,104 @@ static int testSelected(const char* test)
     return selected(UnityFixture.NameFilter, test);
 }
 
+static int rerunSelected(const char* printableName)
+{
+#ifdef UNITY_INCLUDE_RUN_STATE
+    return UnityRunStateSelects(printableName);
+#else
+    (void)printableName;
+    return 1;
+#endif
+}
+
+static int budgetSelected(const char* printableName)
+{
+#ifdef UNITY_INCLUDE_RUN_STATE
+    return UnityTimeBudgetSelects(printableName);
+#else
+    (void)printableName;
+    return 1;
+#endif
+}
+
 static int groupSelected(const char* group)
 {
     return selected(UnityFixture.GroupFilter, group);
 }
 
+/* The group whose tests are running, set up once when the first of them runs */
+static struct
+{
+    const char* Name;
+    unityfunction* TearDown;
+    int SetUpFailed;
+} groupOnce;
+
+static void groupSetUpOnce(const char* group, unityfunction* setupOnce, unityfunction* teardownOnce)
+{
+    if (group != groupOnce.Name)
+    {
+        groupOnce.Name = group;
+        groupOnce.TearDown = teardownOnce;
+        groupOnce.SetUpFailed = 1;
+        if (setupOnce != NULL)
+            setupOnce();
+        groupOnce.SetUpFailed = 0;
+    }
+    else if (groupOnce.SetUpFailed)
+    {
+        UnityFail("TEST_GROUP_SETUP_ONCE Failed", Unity.CurrentTestLineNumber);
+    }
+}
+
+void UnityConcludeFixtureGroup(void)
+{
+    unityfunction* teardownOnce = groupOnce.TearDown;
+
+    /* nothing was set up to tear down if the setup failed */
+    if ((teardownOnce != NULL) && !groupOnce.SetUpFailed)
+    {
+        Unity.CurrentTestName = groupOnce.Name;
+        if (TEST_PROTECT())
+        {
+            teardownOnce();
+        }
+        if (Unity.CurrentTestFailed)
+        {
+            /* a failed tear down counts as a test of its own, so failures never outnumber tests */
+            Unity.NumberOfTests++;
+            Unity.TestFailures++;
+            UNITY_PRINT_EOL();
+        }
+        Unity.CurrentTestFailed = 0;
+        Unity.CurrentTestIgnored = 0;
+    }
+    groupOnce.Name = NULL;
+    groupOnce.TearDown = NULL;
+    groupOnce.SetUpFailed = 0;
+}
+
 void UnityTestRunner(unityfunction* setup,
                      unityfunction* testBody,
                      unityfunction* teardown,
+                     unityfunction* setupOnce,
+                     unityfunction* teardownOnce,
                      const char* printableName,
                      const char* group,
                      const char* name,
                      const char* file,
                      unsigned int line)
 {
-    if (testSelected(name) && groupSelected(group))
+    if (testSelected(name) && groupSelected(group) && UnityShardSelects(printableName) &&
+        rerunSelected(printableName) && UnityFailFastSelects() && budgetSelected(printableName))
     {
+        /* Tests of another group run without RUN_TEST_GROUP end the last group */
+        if (group != groupOnce.Name)
+            UnityConcludeFixtureGroup();
         Unity.TestFile = file;
         Unity.CurrentTestName = printableName;
         Unity.CurrentTestLineNumber = line;
+        UNITY_RUN_STATE_STARTED();
         if (UnityFixture.Verbose)
         {
             UnityPrint(printableName);
@@ -100,6 +186,7 @@ void UnityTestRunner(unityfunction* setup,
 
         if (TEST_PROTECT())
         {
+            groupSetUpOnce(group, setupOnce, teardownOnce);
             setup();
             testBody();
         }
@@ -117,7 +204,8 @@ void UnityTestRunner(unityfunction* setup,
 
 void UnityIgnoreTest(const char* printableName, const char* group, const char* name)
 {
-    if (testSelected(name) && groupSelected(group))
+    if (testSelected(name) && groupSelected(group) && UnityShardSelects(printableName) &&
+        rerunSelected(printableName) && UnityFailFastSelects() && budgetSelected(printableName))
     {
         Unity.NumberOfTests++;
         Unity.TestIgnores++;
@@ -181,14 +269,26 @@ void UnityPointer_UndoAllSets(void)
 int UnityGetCommandLineOptions(int argc, const char* argv[])
 {
     int i;
+#ifdef UNITY_INCLUDE_RUN_STATE
+    int rerunFailed = 0;
+    int failFirst = 0;
+    const char* timingHistory = NULL;
+#endif
     UnityFixture.Verbose = 0;
     UnityFixture.Silent = 0;
     UnityFixture.GroupFilter = 0;
     UnityFixture.NameFilter = 0;
     UnityFixture.RepeatCount = 1;
-
-    if (argc == 1)
-        return 0;
+#ifndef UNITY_EXCLUDE_SHARD_ENV
+    if (UnityShardParse(getenv("UNITY_SHARD")) != 0)
+        return 1;
+#else
+    (void)UnityShardParse(NULL);
+#endif
+    (void)UnityFailFastParse(NULL);
+#ifdef UNITY_INCLUDE_RUN_STATE
+    (void)UnityTimeBudgetParse(NULL);
+#endif
 
     for (i = 1; i < argc; )
     {
@@ -237,23 +337,69 @@ int UnityGetCommandLineOptions(int argc, const char* argv[])
                 }
             }
         }
+        else if ((strcmp(argv[i], "--fail-fast") == 0) || (strncmp(argv[i], "--fail-fast=", 12) == 0))
+        {
+            if (UnityFailFastParse(argv[i][11] == '=' ? argv[i] + 12 : "") != 0)
+                return 1;
+            i++;
+        }
+        else if (strncmp(argv[i], "--shard=", 8) == 0)
+        {
+            if (UnityShardParse(argv[i] + 8) != 0)
+                return 1;
+            i++;
+        }
+#ifdef UNITY_INCLUDE_RUN_STATE
+        else if (strcmp(argv[i], "--rerun-failed") == 0)
+        {
+            rerunFailed = 1;
+            i++;
+        }
+        else if (strcmp(argv[i], "--fail-first") == 0)
+        {
+            failFirst = 1;
+            i++;
+        }
+        else if (strncmp(argv[i], "--timing-history=", 17) == 0)
+        {
+            timingHistory = argv[i] + 17;
+            i++;
+        }
+        else if (strncmp(argv[i], "--time-budget=", 14) == 0)
+        {
+            if (UnityTimeBudgetParse(argv[i] + 14) != 0)
+                return 1;
+            i++;
+        }
+#endif
         else
         {
             /* ignore unknown parameter */
             i++;
         }
     }
+#ifdef UNITY_INCLUDE_RUN_STATE
+    if (UnityRunStateInit(argv[0], rerunFailed, failFirst) != 0)
+        return 1;
+    return UnityShardPlan(timingHistory);
+#else
     return 0;
+#endif
 }
 
 void UnityConcludeFixtureTest(void)
 {
+    UNITY_SNAPSHOT_RESTORE();
+#ifdef UNITY_INCLUDE_RUN_STATE
+    UNITY_EXEC_TIME_STOP();
+    UnityRunStateConcluded();
+#endif
     if (Unity.CurrentTestIgnored)
     {
         Unity.TestIgnores++;
         UNITY_PRINT_EOL();
     }
-    else if (!Unity.CurrentTestFailed)
+    else if (!Unity.CurrentTestFailed && (Unity.CurrentTestExpectFailures == 0))
     {
         if (UnityFixture.Verbose)
         {
@@ -264,6 +410,10 @@ void UnityConcludeFixtureTest(void)
             UNITY_PRINT_EOL();
         }
     }
+    else if (!Unity.CurrentTestFailed) /* Only failed expectations, which ended their own lines */
+    {
+        Unity.TestFailures++;
+    }
     else /* Unity.CurrentTestFailed */
     {
         Unity.TestFailures++;
@@ -272,4 +422,6 @@ void UnityConcludeFixtureTest(void)
 
     Unity.CurrentTestFailed = 0;
     Unity.CurrentTestIgnored = 0;
+    Unity.CurrentTestExpecting = 0;
+    Unity.CurrentTestExpectFailures = 0;
 }
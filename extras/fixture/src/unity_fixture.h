@@ -19,8 +19,17 @@
 int UnityMain(int argc, const char* argv[], void (*runAllTests)(void));
 
 
+#ifdef __cplusplus
 #define TEST_GROUP(group)\
-    static const char* TEST_GROUP_##group = #group
+    static const char* TEST_GROUP_##group = #group;\
+    static unityfunction* TEST_##group##_SETUP_ONCE_HOOK = 0;\
+    static unityfunction* TEST_##group##_TEAR_DOWN_ONCE_HOOK = 0
+#else
+#define TEST_GROUP(group)\
+    static const char* TEST_GROUP_##group = #group;\
+    static unityfunction* TEST_##group##_SETUP_ONCE_HOOK;\
+    static unityfunction* TEST_##group##_TEAR_DOWN_ONCE_HOOK
+#endif
 
 #define TEST_SETUP(group) void TEST_##group##_SETUP(void);\
     void TEST_##group##_SETUP(void)
@@ -28,6 +37,26 @@ int UnityMain(int argc, const char* argv[], void (*runAllTests)(void));
 #define TEST_TEAR_DOWN(group) void TEST_##group##_TEAR_DOWN(void);\
     void TEST_##group##_TEAR_DOWN(void)
 
+/* Optional, and run once for all the tests of a group that are selected: the
+ * setup before the first of them, the tear down once the group has run. */
+#ifdef __cplusplus
+#define TEST_GROUP_SETUP_ONCE(group) static void TEST_##group##_SETUP_ONCE(void);\
+    static UnityFixtureOnceHook TEST_##group##_SETUP_ONCE_SET(&TEST_##group##_SETUP_ONCE_HOOK, TEST_##group##_SETUP_ONCE);\
+    static void TEST_##group##_SETUP_ONCE(void)
+
+#define TEST_GROUP_TEAR_DOWN_ONCE(group) static void TEST_##group##_TEAR_DOWN_ONCE(void);\
+    static UnityFixtureOnceHook TEST_##group##_TEAR_DOWN_ONCE_SET(&TEST_##group##_TEAR_DOWN_ONCE_HOOK, TEST_##group##_TEAR_DOWN_ONCE);\
+    static void TEST_##group##_TEAR_DOWN_ONCE(void)
+#else
+#define TEST_GROUP_SETUP_ONCE(group) static void TEST_##group##_SETUP_ONCE(void);\
+    static unityfunction* TEST_##group##_SETUP_ONCE_HOOK = TEST_##group##_SETUP_ONCE;\
+    static void TEST_##group##_SETUP_ONCE(void)
+
+#define TEST_GROUP_TEAR_DOWN_ONCE(group) static void TEST_##group##_TEAR_DOWN_ONCE(void);\
+    static unityfunction* TEST_##group##_TEAR_DOWN_ONCE_HOOK = TEST_##group##_TEAR_DOWN_ONCE;\
+    static void TEST_##group##_TEAR_DOWN_ONCE(void)
+#endif
+
 
 #define TEST(group, name) \
     void TEST_##group##_##name##_(void);\
@@ -37,6 +66,8 @@ int UnityMain(int argc, const char* argv[], void (*runAllTests)(void));
         UnityTestRunner(TEST_##group##_SETUP,\
             TEST_##group##_##name##_,\
             TEST_##group##_TEAR_DOWN,\
+            TEST_##group##_SETUP_ONCE_HOOK,\
+            TEST_##group##_TEAR_DOWN_ONCE_HOOK,\
             "TEST(" #group ", " #name ")",\
             TEST_GROUP_##group, #name,\
             __FILE__, __LINE__);\
@@ -48,6 +79,8 @@ int UnityMain(int argc, const char* argv[], void (*runAllTests)(void));
     void TEST_##group##_##name##_run(void);\
     void TEST_##group##_##name##_run(void)\
     {\
+        (void)TEST_##group##_SETUP_ONCE_HOOK;\
+        (void)TEST_##group##_TEAR_DOWN_ONCE_HOOK;\
         UnityIgnoreTest("IGNORE_TEST(" #group ", " #name ")", TEST_GROUP_##group, #name);\
     }\
     void TEST_##group##_##name##_(void)
@@ -65,7 +98,8 @@ int UnityMain(int argc, const char* argv[], void (*runAllTests)(void));
 /* Call this from main */
 #define RUN_TEST_GROUP(group)\
     { void TEST_##group##_GROUP_RUNNER(void);\
-      TEST_##group##_GROUP_RUNNER(); }
+      TEST_##group##_GROUP_RUNNER();\
+      UnityConcludeFixtureGroup(); }
 
 /* CppUTest Compatibility Macros */
 #ifndef UNITY_EXCLUDE_CPPUTEST_ASSERTS
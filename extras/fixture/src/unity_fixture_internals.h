@@ -27,6 +27,8 @@ typedef void unityfunction(void);
 void UnityTestRunner(unityfunction* setup,
                      unityfunction* testBody,
                      unityfunction* teardown,
+                     unityfunction* setupOnce,
+                     unityfunction* teardownOnce,
                      const char* printableName,
                      const char* group,
                      const char* name,
@@ -35,6 +37,7 @@ void UnityTestRunner(unityfunction* setup,
 void UnityIgnoreTest(const char* printableName, const char* group, const char* name);
 int UnityGetCommandLineOptions(int argc, const char* argv[]);
 void UnityConcludeFixtureTest(void);
+void UnityConcludeFixtureGroup(void);
 
 void UnityPointer_Set(void** pointer, void* newValue, UNITY_LINE_TYPE line);
 void UnityPointer_UndoAllSets(void);
@@ -45,6 +48,13 @@ void UnityPointer_Init(void);
 
 #ifdef __cplusplus
 }
+
+/* C++ allows only one definition of a group's hook, so TEST_GROUP_SETUP_ONCE
+ * and TEST_GROUP_TEAR_DOWN_ONCE set it with one of these as the program starts */
+struct UnityFixtureOnceHook
+{
+    UnityFixtureOnceHook(unityfunction** hook, unityfunction* func) { *hook = func; }
+};
 #endif
 
 #endif /* UNITY_FIXTURE_INTERNALS_H_ */
@@ -9,6 +9,7 @@
 
 static void runAllTests(void)
 {
+    RUN_TEST_GROUP(UnityGroupOnce);
     RUN_TEST_GROUP(UnityFixture);
     RUN_TEST_GROUP(UnityCommandOptions);
 }
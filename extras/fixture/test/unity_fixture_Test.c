@@ -107,6 +107,8 @@ TEST_TEAR_DOWN(UnityCommandOptions)
     UnityFixture.RepeatCount= savedRepeat;
     UnityFixture.NameFilter = savedName;
     UnityFixture.GroupFilter = savedGroup;
+    UnityShardParse(NULL);
+    UnityFailFastParse(NULL);
 }
 
 
@@ -239,7 +241,242 @@ TEST(UnityCommandOptions, GroupFilterReallyFilters)
     TEST_ASSERT_EQUAL(saved, Unity.NumberOfTests);
 }
 
+static const char* shard[] = {
+        "testrunner.exe",
+        "--shard=2/3"
+};
+
+TEST(UnityCommandOptions, OptionShardTakesTurnsOverTests)
+{
+    TEST_ASSERT_EQUAL(0, UnityGetCommandLineOptions(2, shard));
+    TEST_ASSERT_FALSE(UnityShardSelects(NULL));
+    TEST_ASSERT_TRUE(UnityShardSelects(NULL));
+    TEST_ASSERT_FALSE(UnityShardSelects(NULL));
+    TEST_ASSERT_FALSE(UnityShardSelects(NULL));
+    TEST_ASSERT_TRUE(UnityShardSelects(NULL));
+}
+
+static const char* badShards[] = {
+        "testrunner.exe",
+        "--shard=0/3",
+        "--shard=4/3",
+        "--shard=1/0",
+        "--shard=2",
+        "--shard=1/2x",
+        "--shard="
+};
+
+TEST(UnityCommandOptions, OptionShardRejectsInvalidShards)
+{
+    int i;
+    for (i = 1; i < 7; i++)
+    {
+        const char* argv[2];
+        argv[0] = badShards[0];
+        argv[1] = badShards[i];
+        TEST_ASSERT_EQUAL_MESSAGE(1, UnityGetCommandLineOptions(2, argv), badShards[i]);
+    }
+}
+
+static const char* failFast[] = {
+        "testrunner.exe",
+        "--fail-fast=2",
+        "--fail-fast=0",
+        "--fail-fast=two"
+};
+
+TEST(UnityCommandOptions, OptionFailFastStopsAfterFailures)
+{
+    UNITY_COUNTER_TYPE savedFailures = Unity.TestFailures;
+    TEST_ASSERT_EQUAL(0, UnityGetCommandLineOptions(2, failFast));
+    Unity.TestFailures = 1;
+    TEST_ASSERT_TRUE(UnityFailFastSelects());
+    Unity.TestFailures = 2;
+    TEST_ASSERT_FALSE(UnityFailFastSelects());
+    Unity.TestFailures = savedFailures;
+}
+
+TEST(UnityCommandOptions, OptionFailFastRejectsInvalidCounts)
+{
+    const char* argv[2];
+    argv[0] = failFast[0];
+    argv[1] = failFast[2];
+    TEST_ASSERT_EQUAL(1, UnityGetCommandLineOptions(2, argv));
+    argv[1] = failFast[3];
+    TEST_ASSERT_EQUAL(1, UnityGetCommandLineOptions(2, argv));
+}
+
+#ifdef UNITY_INCLUDE_RUN_STATE
+static const char* repeatFailFirst[] = {
+        "testrunner.exe",
+        "-r", "2",
+        "--fail-first"
+};
+
+TEST(UnityCommandOptions, OptionRepeatStartsEachRunFromTheFirstPass)
+{
+    struct UNITY_STORAGE_T savedUnity = Unity;
+    int selectedFirst[2];
+    int passes[2];
+    unsigned int r;
+
+    TEST_ASSERT_EQUAL(0, UnityGetCommandLineOptions(4, repeatFailFirst));
+    TEST_ASSERT_EQUAL(2, UnityFixture.RepeatCount);
+    for (r = 0; r < 2; r++)
+    {
+        /* as UnityMain does: a test not known to fail waits for the second pass */
+        UnityBegin(repeatFailFirst[0]);
+        selectedFirst[r] = UnityRunStateSelects("TEST(UnityCommandOptions, New)");
+        passes[r] = 1;
+        while (UNITY_RUN_STATE_NEXT_PASS())
+            passes[r]++;
+    }
+    Unity = savedUnity;
+    TEST_ASSERT_EQUAL(0, UnityGetCommandLineOptions(1, repeatFailFirst));
+
+    TEST_ASSERT_EQUAL(0, selectedFirst[0]);
+    TEST_ASSERT_EQUAL(0, selectedFirst[1]);
+    TEST_ASSERT_EQUAL(2, passes[0]);
+    TEST_ASSERT_EQUAL(2, passes[1]);
+}
+#endif
+
 IGNORE_TEST(UnityCommandOptions, TestShouldBeIgnored)
 {
     TEST_FAIL_MESSAGE("This test should not run!");
 }
+
+/*------------------------------------------------------------ */
+
+TEST_GROUP(UnityGroupOnce);
+
+static int setUpOnceCount = 0;
+static int tearDownOnceCount = 0;
+static int groupSetUpCount = 0;
+
+TEST_GROUP_SETUP_ONCE(UnityGroupOnce)
+{
+    setUpOnceCount++;
+    groupSetUpCount = 0;
+}
+
+TEST_GROUP_TEAR_DOWN_ONCE(UnityGroupOnce)
+{
+    tearDownOnceCount++;
+}
+
+TEST_SETUP(UnityGroupOnce)
+{
+    groupSetUpCount++;
+}
+
+TEST_TEAR_DOWN(UnityGroupOnce)
+{
+}
+
+TEST(UnityGroupOnce, SetUpOnceRunsBeforeTheFirstTest)
+{
+    TEST_ASSERT_EQUAL_INT(tearDownOnceCount + 1, setUpOnceCount);
+    TEST_ASSERT_TRUE(groupSetUpCount >= 1);
+}
+
+TEST(UnityGroupOnce, SetUpOnceIsNotRunAgainForLaterTests)
+{
+    TEST_ASSERT_EQUAL_INT(tearDownOnceCount + 1, setUpOnceCount);
+    TEST_ASSERT_TRUE(groupSetUpCount >= 1);
+}
+
+TEST(UnityFixture, GroupTearDownOnceRanAfterItsGroup)
+{
+    TEST_ASSERT_EQUAL_INT(setUpOnceCount, tearDownOnceCount);
+}
+
+TEST(UnityFixture, GroupSetUpOnceSkippedWhenGroupFilteredOut)
+{
+    void TEST_UnityGroupOnce_GROUP_RUNNER(void);
+    const char* savedGroupFilter = UnityFixture.GroupFilter;
+    int savedSetUpOnceCount = setUpOnceCount;
+
+    UnityFixture.GroupFilter = "NoSuchGroup";
+    TEST_UnityGroupOnce_GROUP_RUNNER();
+    UnityFixture.GroupFilter = savedGroupFilter;
+    TEST_ASSERT_EQUAL_INT(savedSetUpOnceCount, setUpOnceCount);
+}
+
+/* A group run from inside another test, whose once hooks fail on request */
+TEST_GROUP(UnityGroupOnceFails);
+
+static int failSetUpOnce = 0;
+static int failTearDownOnce = 0;
+static int failingTearDownOnceCount = 0;
+
+static void failWithoutMessage(void)
+{
+    Unity.CurrentTestFailed = 1;
+    TEST_ABORT();
+}
+
+TEST_GROUP_SETUP_ONCE(UnityGroupOnceFails)
+{
+    if (failSetUpOnce)
+        failWithoutMessage();
+}
+
+TEST_GROUP_TEAR_DOWN_ONCE(UnityGroupOnceFails)
+{
+    failingTearDownOnceCount++;
+    if (failTearDownOnce)
+        failWithoutMessage();
+}
+
+TEST_SETUP(UnityGroupOnceFails)
+{
+}
+
+TEST_TEAR_DOWN(UnityGroupOnceFails)
+{
+}
+
+TEST(UnityGroupOnceFails, Passes)
+{
+}
+
+TEST(UnityFixture, GroupTearDownOnceFailureCountsAsATest)
+{
+    void TEST_UnityGroupOnceFails_GROUP_RUNNER(void);
+    struct UNITY_STORAGE_T savedUnity = Unity;
+    UNITY_COUNTER_TYPE tests;
+    UNITY_COUNTER_TYPE failures;
+
+    failTearDownOnce = 1;
+    TEST_UnityGroupOnceFails_GROUP_RUNNER();
+    UnityConcludeFixtureGroup();
+    failTearDownOnce = 0;
+    tests = Unity.NumberOfTests - savedUnity.NumberOfTests;
+    failures = Unity.TestFailures - savedUnity.TestFailures;
+    Unity = savedUnity;
+
+    TEST_ASSERT_EQUAL(2, tests);
+    TEST_ASSERT_EQUAL(1, failures);
+}
+
+TEST(UnityFixture, GroupTearDownOnceSkippedWhenSetUpOnceFailed)
+{
+    void TEST_UnityGroupOnceFails_GROUP_RUNNER(void);
+    struct UNITY_STORAGE_T savedUnity = Unity;
+    int savedTearDownOnceCount = failingTearDownOnceCount;
+    UNITY_COUNTER_TYPE tests;
+    UNITY_COUNTER_TYPE failures;
+
+    failSetUpOnce = 1;
+    TEST_UnityGroupOnceFails_GROUP_RUNNER();
+    UnityConcludeFixtureGroup();
+    failSetUpOnce = 0;
+    tests = Unity.NumberOfTests - savedUnity.NumberOfTests;
+    failures = Unity.TestFailures - savedUnity.TestFailures;
+    Unity = savedUnity;
+
+    TEST_ASSERT_EQUAL_INT(savedTearDownOnceCount, failingTearDownOnceCount);
+    TEST_ASSERT_EQUAL(1, tests);
+    TEST_ASSERT_EQUAL(1, failures);
+}
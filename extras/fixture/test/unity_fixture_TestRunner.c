@@ -13,6 +13,10 @@ TEST_GROUP_RUNNER(UnityFixture)
     RUN_TEST_CASE(UnityFixture, PointerSet);
     RUN_TEST_CASE(UnityFixture, FreeNULLSafety);
     RUN_TEST_CASE(UnityFixture, ConcludeTestIncrementsFailCount);
+    RUN_TEST_CASE(UnityFixture, GroupTearDownOnceRanAfterItsGroup);
+    RUN_TEST_CASE(UnityFixture, GroupSetUpOnceSkippedWhenGroupFilteredOut);
+    RUN_TEST_CASE(UnityFixture, GroupTearDownOnceFailureCountsAsATest);
+    RUN_TEST_CASE(UnityFixture, GroupTearDownOnceSkippedWhenSetUpOnceFailed);
 }
 
 TEST_GROUP_RUNNER(UnityCommandOptions)
@@ -28,5 +32,23 @@ TEST_GROUP_RUNNER(UnityCommandOptions)
     RUN_TEST_CASE(UnityCommandOptions, UnknownCommandIsIgnored);
     RUN_TEST_CASE(UnityCommandOptions, GroupOrNameFilterWithoutStringFails);
     RUN_TEST_CASE(UnityCommandOptions, GroupFilterReallyFilters);
+    RUN_TEST_CASE(UnityCommandOptions, OptionShardTakesTurnsOverTests);
+    RUN_TEST_CASE(UnityCommandOptions, OptionShardRejectsInvalidShards);
+    RUN_TEST_CASE(UnityCommandOptions, OptionFailFastStopsAfterFailures);
+    RUN_TEST_CASE(UnityCommandOptions, OptionFailFastRejectsInvalidCounts);
+#ifdef UNITY_INCLUDE_RUN_STATE
+    RUN_TEST_CASE(UnityCommandOptions, OptionRepeatStartsEachRunFromTheFirstPass);
+#endif
     RUN_TEST_CASE(UnityCommandOptions, TestShouldBeIgnored);
 }
+
+TEST_GROUP_RUNNER(UnityGroupOnce)
+{
+    RUN_TEST_CASE(UnityGroupOnce, SetUpOnceRunsBeforeTheFirstTest);
+    RUN_TEST_CASE(UnityGroupOnce, SetUpOnceIsNotRunAgainForLaterTests);
+}
+
+TEST_GROUP_RUNNER(UnityGroupOnceFails)
+{
+    RUN_TEST_CASE(UnityGroupOnceFails, Passes);
+}
@@ -0,0 +1,161 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+/* A long running process that loads test suites built as shared objects and
+ * runs them on command, one command per line on stdin:
+ *
+ *   run path/to/suite.so [runner options...]
+ *   quit
+ *
+ * A suite stays loaded between runs and is only loaded again once it has been
+ * rebuilt, so a run costs neither process startup nor dynamic linking. */
+
+#include "unity_host.h"
+#include <dlfcn.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+typedef int (*UnityHostEntry)(int argc, char** argv);
+
+typedef struct
+{
+    char Path[UNITY_HOST_LINE_MAX];
+    void* Handle;
+    UnityHostEntry Entry;
+    struct stat Built;
+} UNITY_HOST_SUITE_T;
+
+static UNITY_HOST_SUITE_T suites[UNITY_HOST_MAX_SUITES];
+
+static int sameBuild(const struct stat* a, const struct stat* b)
+{
+    return (a->st_dev == b->st_dev) && (a->st_ino == b->st_ino) &&
+           (a->st_size == b->st_size) && (a->st_mtime == b->st_mtime);
+}
+
+static UNITY_HOST_SUITE_T* findSuite(const char* path)
+{
+    UNITY_HOST_SUITE_T* unused = NULL;
+    int i;
+
+    for (i = 0; i < UNITY_HOST_MAX_SUITES; i++)
+    {
+        if (suites[i].Handle == NULL)
+        {
+            if (unused == NULL)
+                unused = &suites[i];
+        }
+        else if (strcmp(suites[i].Path, path) == 0)
+        {
+            return &suites[i];
+        }
+    }
+    return unused;
+}
+
+/* Returns the suite at path, loading it first if it is new or was rebuilt */
+static UNITY_HOST_SUITE_T* loadSuite(const char* path)
+{
+    UNITY_HOST_SUITE_T* suite;
+    struct stat built;
+    union
+    {
+        void* Symbol;
+        UnityHostEntry Entry;
+    } entry;
+
+    if (stat(path, &built) != 0)
+    {
+        printf("ERROR: Cannot Find Suite %s\n", path);
+        return NULL;
+    }
+    suite = findSuite(path);
+    if (suite == NULL)
+    {
+        printf("ERROR: Too Many Suites Loaded\n");
+        return NULL;
+    }
+    if (suite->Handle != NULL)
+    {
+        if (sameBuild(&suite->Built, &built))
+            return suite;
+        printf("RELOADING %s\n", path);
+        dlclose(suite->Handle);
+        suite->Handle = NULL;
+    }
+
+    suite->Handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (suite->Handle == NULL)
+    {
+        printf("ERROR: %s\n", dlerror());
+        return NULL;
+    }
+    entry.Symbol = dlsym(suite->Handle, UNITY_HOST_ENTRY);
+    if (entry.Symbol == NULL)
+    {
+        printf("ERROR: %s Has No %s\n", path, UNITY_HOST_ENTRY);
+        dlclose(suite->Handle);
+        suite->Handle = NULL;
+        return NULL;
+    }
+    strncpy(suite->Path, path, sizeof(suite->Path) - 1);
+    suite->Path[sizeof(suite->Path) - 1] = '\0';
+    suite->Entry = entry.Entry;
+    suite->Built = built;
+    return suite;
+}
+
+/* Splits a command into words at spaces and tabs */
+static int splitCommand(char* line, char** argv)
+{
+    int argc = 0;
+
+    while (*line != '\0')
+    {
+        while ((*line == ' ') || (*line == '\t') || (*line == '\n') || (*line == '\r'))
+            *line++ = '\0';
+        if ((*line == '\0') || (argc == UNITY_HOST_MAX_ARGS))
+            break;
+        argv[argc++] = line;
+        while ((*line != '\0') && (*line != ' ') && (*line != '\t') && (*line != '\n') && (*line != '\r'))
+            line++;
+    }
+    argv[argc] = NULL;
+    return argc;
+}
+
+int main(void)
+{
+    char line[UNITY_HOST_LINE_MAX];
+
+    while (fgets(line, (int)sizeof(line), stdin) != NULL)
+    {
+        char* argv[UNITY_HOST_MAX_ARGS + 1];
+        int argc = splitCommand(line, argv);
+        int status = -1;
+
+        if (argc == 0)
+            continue;
+        if (strcmp(argv[0], "quit") == 0)
+            break;
+        if ((strcmp(argv[0], "run") == 0) && (argc > 1))
+        {
+            UNITY_HOST_SUITE_T* suite = loadSuite(argv[1]);
+
+            /* the suite sees its own path as argv[0], as a test executable would */
+            if (suite != NULL)
+                status = suite->Entry(argc - 1, &argv[1]);
+        }
+        else
+        {
+            printf("ERROR: Unknown Command %s\n", argv[0]);
+        }
+        printf(UNITY_HOST_DONE " %d\n", status);
+        fflush(stdout);
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#ifndef UNITY_HOST_H_
+#define UNITY_HOST_H_
+
+/* Every suite the host loads is a shared object exporting a function by this
+ * name, shaped like a runner's main. generate_test_runner.rb makes one when
+ * given :main_name => unity_host_main. */
+#ifndef UNITY_HOST_ENTRY
+#define UNITY_HOST_ENTRY "unity_host_main"
+#endif
+
+/* How many suites stay loaded at once */
+#ifndef UNITY_HOST_MAX_SUITES
+#define UNITY_HOST_MAX_SUITES 16
+#endif
+
+/* The longest command line read, and the most words it is split into */
+#ifndef UNITY_HOST_LINE_MAX
+#define UNITY_HOST_LINE_MAX 1024
+#endif
+
+#ifndef UNITY_HOST_MAX_ARGS
+#define UNITY_HOST_MAX_ARGS 32
+#endif
+
+/* Ends the output of every command, followed by its exit status */
+#define UNITY_HOST_DONE "UNITY_HOST_DONE"
+
+#endif /* UNITY_HOST_H_ */
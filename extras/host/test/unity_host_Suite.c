@@ -0,0 +1,45 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+/* A suite for the host to load. It counts its runs in a static, which only
+ * survives from one run to the next while the host keeps it loaded. */
+
+#include "unity.h"
+
+static int runs = 0;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void test_CountsRunsWhileLoaded(void)
+{
+    char message[] = "Run 0";
+
+    runs++;
+    message[4] = (char)('0' + (runs % 10));
+    TEST_MESSAGE(message);
+}
+
+static void test_Passes(void)
+{
+    TEST_PASS();
+}
+
+int unity_host_main(int argc, char** argv);
+int unity_host_main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+    UnityBegin("unity_host_Suite.c");
+    RUN_TEST(test_CountsRunsWhileLoaded);
+    RUN_TEST(test_Passes);
+    return UnityEnd();
+}
@@ -0,0 +1,44 @@
+#!/bin/sh
+# Runs a suite twice in one host, rebuilds it and runs it again. The second run
+# must find it still loaded, and the third must find it loaded afresh.
+#   unity_host_Test.sh HOST SUITE REBUILD_COMMAND
+HOST=$1
+SUITE=$2
+REBUILD=$3
+OUT=$SUITE.out
+
+done_count() {
+    grep -c UNITY_HOST_DONE "$OUT" 2>/dev/null || true
+}
+
+wait_for() {
+    tries=0
+    while [ "$(done_count)" -lt "$1" ]; do
+        tries=$((tries + 1))
+        if [ $tries -gt 100 ]; then
+            echo "FAIL: host did not answer"
+            exit 1
+        fi
+        sleep 0.1
+    done
+}
+
+rm -f "$OUT"
+{
+    printf 'run %s\nrun %s\n' "$SUITE" "$SUITE"
+    wait_for 2
+    sh -c "$REBUILD" || exit 1
+    printf 'run %s\nquit\n' "$SUITE"
+} | "$HOST" > "$OUT"
+
+cat "$OUT"
+EXPECTED="Run 1
+Run 2
+RELOADING $SUITE
+Run 1"
+ACTUAL=$(grep -o -e 'Run [0-9]' -e "RELOADING .*" "$OUT")
+if [ "$ACTUAL" != "$EXPECTED" ] || [ "$(grep -c 'UNITY_HOST_DONE 0' "$OUT")" -ne 3 ]; then
+    echo "FAIL: host did not keep the suite loaded until it was rebuilt"
+    exit 1
+fi
+echo "OK"
@@ -0,0 +1,446 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+/* Runs many test executables at once, one per core, and adds up their results
+ * into a single summary:
+ *
+ *   unity_parallel [-j jobs] [--min-shard=tests] runner_or_directory... [-- runner options]
+ *
+ * Each runner must be built with UNITY_USE_COMMAND_LINE_ARGS. Its tests are
+ * counted with -l first, and big runners are split with --shard=i/N so their
+ * tests spread across the cores too. */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "unity_parallel.h"
+#include <dirent.h>
+#include <errno.h>
+#include <poll.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+typedef struct
+{
+    char* Runner;
+    unsigned int Shard;
+    unsigned int Shards;
+    int List;
+    pid_t Pid;
+    int Output;
+    char* Text;
+    size_t Used;
+    size_t Size;
+    int Status;
+} UNITY_PARALLEL_TASK_T;
+
+static char* runners[UNITY_PARALLEL_MAX_RUNNERS];
+static unsigned int runnerTests[UNITY_PARALLEL_MAX_RUNNERS];
+static unsigned int order[UNITY_PARALLEL_MAX_RUNNERS];
+static unsigned int runnerCount = 0;
+static UNITY_PARALLEL_TASK_T tasks[UNITY_PARALLEL_MAX_TASKS];
+static unsigned int taskCount = 0;
+static char** runnerArgs = NULL;
+static unsigned int runnerArgCount = 0;
+
+static char listOption[] = "-l";
+
+static int addRunner(char* path)
+{
+    if (runnerCount == UNITY_PARALLEL_MAX_RUNNERS)
+    {
+        printf("ERROR: Too Many Runners\n");
+        return 0;
+    }
+    runners[runnerCount++] = path;
+    return 1;
+}
+
+/* Every executable file directly in a directory is taken to be a runner */
+static int addDirectory(const char* path)
+{
+    DIR* dir = opendir(path);
+    struct dirent* entry;
+    int ok = 1;
+
+    if (dir == NULL)
+    {
+        printf("ERROR: Cannot Open %s\n", path);
+        return 0;
+    }
+    while (ok && ((entry = readdir(dir)) != NULL))
+    {
+        struct stat info;
+        size_t length = strlen(path) + strlen(entry->d_name) + 2;
+        char* file = (char*)malloc(length);
+
+        if (file == NULL)
+        {
+            ok = 0;
+            break;
+        }
+        snprintf(file, length, "%s/%s", path, entry->d_name);
+        if ((stat(file, &info) == 0) && S_ISREG(info.st_mode) && (access(file, X_OK) == 0))
+        {
+            ok = addRunner(file);
+        }
+        else
+        {
+            free(file);
+        }
+    }
+    closedir(dir);
+    return ok;
+}
+
+static int addTask(char* runner, unsigned int shard, unsigned int shards, int list)
+{
+    UNITY_PARALLEL_TASK_T* task;
+
+    if (taskCount == UNITY_PARALLEL_MAX_TASKS)
+    {
+        printf("ERROR: Too Many Tasks\n");
+        return 0;
+    }
+    task = &tasks[taskCount++];
+    memset(task, 0, sizeof(*task));
+    task->Runner = runner;
+    task->Shard = shard;
+    task->Shards = shards;
+    task->List = list;
+    task->Output = -1;
+    return 1;
+}
+
+/* Starts a task with its stdout and stderr going to a pipe */
+static int startTask(UNITY_PARALLEL_TASK_T* task)
+{
+    char shard[32];
+    char* argv[UNITY_PARALLEL_MAX_ARGS + 4];
+    posix_spawn_file_actions_t actions;
+    int pipeFds[2];
+    unsigned int argc = 0;
+    unsigned int i;
+
+    argv[argc++] = task->Runner;
+    if (task->List)
+    {
+        argv[argc++] = listOption;
+    }
+    else
+    {
+        if (task->Shards > 1)
+        {
+            snprintf(shard, sizeof(shard), "--shard=%u/%u", task->Shard, task->Shards);
+            argv[argc++] = shard;
+        }
+        for (i = 0; i < runnerArgCount; i++)
+        {
+            argv[argc++] = runnerArgs[i];
+        }
+    }
+    argv[argc] = NULL;
+
+    if (pipe(pipeFds) != 0)
+    {
+        return 0;
+    }
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addclose(&actions, pipeFds[0]);
+    posix_spawn_file_actions_adddup2(&actions, pipeFds[1], STDOUT_FILENO);
+    posix_spawn_file_actions_adddup2(&actions, pipeFds[1], STDERR_FILENO);
+    posix_spawn_file_actions_addclose(&actions, pipeFds[1]);
+    if (posix_spawn(&task->Pid, task->Runner, &actions, NULL, argv, environ) != 0)
+    {
+        task->Pid = 0;
+    }
+    posix_spawn_file_actions_destroy(&actions);
+    close(pipeFds[1]);
+    if (task->Pid == 0)
+    {
+        close(pipeFds[0]);
+        printf("ERROR: Cannot Start %s\n", task->Runner);
+        return 0;
+    }
+    task->Output = pipeFds[0];
+    return 1;
+}
+
+/* Reads what a task wrote. Returns 0 once it has closed its output. */
+static int readTask(UNITY_PARALLEL_TASK_T* task)
+{
+    ssize_t got;
+
+    if ((task->Size - task->Used) < 4096)
+    {
+        size_t size = (task->Size == 0) ? 8192 : (task->Size * 2);
+        char* text = (char*)realloc(task->Text, size);
+
+        if (text == NULL)
+        {
+            return 0;
+        }
+        task->Text = text;
+        task->Size = size;
+    }
+    got = read(task->Output, task->Text + task->Used, task->Size - task->Used - 1);
+    if ((got < 0) && (errno == EINTR))
+    {
+        return 1;
+    }
+    if (got <= 0)
+    {
+        return 0;
+    }
+    task->Used += (size_t)got;
+    return 1;
+}
+
+/* Runs the tasks in [first, last), at most jobs at a time. Each finished
+ * task is handed to done in the order they finish. */
+static void runTasks(unsigned int first, unsigned int last, unsigned int jobs,
+                     void (*done)(UNITY_PARALLEL_TASK_T* task))
+{
+    struct pollfd fds[UNITY_PARALLEL_MAX_JOBS];
+    UNITY_PARALLEL_TASK_T* running[UNITY_PARALLEL_MAX_JOBS];
+    unsigned int active = 0;
+    unsigned int next = first;
+
+    while ((next < last) || (active > 0))
+    {
+        unsigned int i;
+
+        while ((next < last) && (active < jobs))
+        {
+            UNITY_PARALLEL_TASK_T* task = &tasks[next++];
+
+            if (startTask(task))
+            {
+                running[active++] = task;
+            }
+            else
+            {
+                task->Status = -1;
+                done(task);
+            }
+        }
+        for (i = 0; i < active; i++)
+        {
+            fds[i].fd = running[i]->Output;
+            fds[i].events = POLLIN;
+            fds[i].revents = 0;
+        }
+        if ((poll(fds, active, -1) < 0) && (errno != EINTR))
+        {
+            return;
+        }
+        for (i = active; i > 0; i--)
+        {
+            UNITY_PARALLEL_TASK_T* task = running[i - 1];
+
+            if ((fds[i - 1].revents == 0) || readTask(task))
+            {
+                continue;
+            }
+            close(task->Output);
+            task->Output = -1;
+            if (task->Text != NULL)
+            {
+                task->Text[task->Used] = '\0';
+            }
+            while ((waitpid(task->Pid, &task->Status, 0) < 0) && (errno == EINTR))
+            {
+            }
+            running[i - 1] = running[--active];
+            done(task);
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+static unsigned int totalTests = 0;
+static unsigned int totalFailures = 0;
+static unsigned int totalIgnores = 0;
+static unsigned int brokenRunners = 0;
+
+/* A runner lists its file name, then each of its tests on a line of its own,
+ * indented by two spaces */
+static void listed(UNITY_PARALLEL_TASK_T* task)
+{
+    const char* line = (task->Text != NULL) ? task->Text : "";
+    unsigned int count = 0;
+    unsigned int i;
+
+    for (; *line != '\0'; line++)
+    {
+        if (((line == task->Text) || (line[-1] == '\n')) && (line[0] == ' ') && (line[1] == ' '))
+        {
+            count++;
+        }
+    }
+    for (i = 0; i < runnerCount; i++)
+    {
+        if (runners[i] == task->Runner)
+        {
+            runnerTests[i] = count;
+        }
+    }
+}
+
+static void finished(UNITY_PARALLEL_TASK_T* task)
+{
+    const char* line = (task->Text != NULL) ? task->Text : "";
+    int summarized = 0;
+    unsigned int tests = 0;
+    unsigned int failures = 0;
+    unsigned int ignores = 0;
+
+    if (task->Used > 0)
+    {
+        fwrite(task->Text, 1, task->Used, stdout);
+    }
+    /* add up every summary line: a fixture runner given -r prints one for each
+     * repeat, and each repeat ran its tests again */
+    while (*line != '\0')
+    {
+        if (sscanf(line, "%u Tests %u Failures %u Ignored", &tests, &failures, &ignores) == 3)
+        {
+            summarized = 1;
+            totalTests += tests;
+            totalFailures += failures;
+            totalIgnores += ignores;
+        }
+        line = strchr(line, '\n');
+        if (line == NULL)
+        {
+            break;
+        }
+        line++;
+    }
+    if (!summarized || !WIFEXITED(task->Status))
+    {
+        /* it crashed or never got to the end, so count it as a failure */
+        printf("%s:", task->Runner);
+        if (task->Shards > 1)
+        {
+            printf(" shard %u/%u", task->Shard, task->Shards);
+        }
+        printf(" FAIL: Runner Did Not Finish\n");
+        brokenRunners++;
+    }
+    free(task->Text);
+    task->Text = NULL;
+    fflush(stdout);
+}
+
+/*-----------------------------------------------*/
+int main(int argc, char** argv)
+{
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned int jobs = (cores > 0) ? (unsigned int)cores : 1;
+    unsigned int minShard = UNITY_PARALLEL_MIN_SHARD;
+    unsigned int args = (argc > 0) ? (unsigned int)argc : 0;
+    unsigned int i;
+    unsigned int arg;
+
+    for (arg = 1; arg < args; arg++)
+    {
+        struct stat info;
+
+        if (strcmp(argv[arg], "--") == 0)
+        {
+            runnerArgs = &argv[arg + 1];
+            runnerArgCount = args - arg - 1;
+            if (runnerArgCount > UNITY_PARALLEL_MAX_ARGS)
+            {
+                printf("ERROR: Too Many Runner Options\n");
+                return 1;
+            }
+            break;
+        }
+        if ((strcmp(argv[arg], "-j") == 0) && ((arg + 1) < args))
+        {
+            jobs = (unsigned int)strtoul(argv[++arg], NULL, 10);
+        }
+        else if (strncmp(argv[arg], "--min-shard=", 12) == 0)
+        {
+            minShard = (unsigned int)strtoul(argv[arg] + 12, NULL, 10);
+        }
+        else if ((stat(argv[arg], &info) == 0) && S_ISDIR(info.st_mode))
+        {
+            if (!addDirectory(argv[arg]))
+                return 1;
+        }
+        else if (!addRunner(argv[arg]))
+        {
+            return 1;
+        }
+    }
+    if ((jobs == 0) || (minShard == 0) || (runnerCount == 0))
+    {
+        printf("ERROR: Usage: unity_parallel [-j jobs] [--min-shard=tests] runner_or_directory... [-- runner options]\n");
+        return 1;
+    }
+    if (jobs > UNITY_PARALLEL_MAX_JOBS)
+    {
+        jobs = UNITY_PARALLEL_MAX_JOBS;
+    }
+
+    /* count the tests of every runner */
+    for (i = 0; i < runnerCount; i++)
+    {
+        if (!addTask(runners[i], 0, 0, 1))
+            return 1;
+    }
+    runTasks(0, taskCount, jobs, listed);
+
+    /* split each runner into shards of at least minShard tests, up to one per
+     * job, and start with the biggest runners so the small ones fill the gaps */
+    taskCount = 0;
+    for (i = 0; i < runnerCount; i++)
+    {
+        order[i] = i;
+    }
+    for (i = 0; i < runnerCount; i++)
+    {
+        unsigned int biggest = i;
+        unsigned int swap;
+        unsigned int shards;
+        unsigned int shard;
+        unsigned int j;
+
+        for (j = i + 1; j < runnerCount; j++)
+        {
+            if (runnerTests[order[j]] > runnerTests[order[biggest]])
+            {
+                biggest = j;
+            }
+        }
+        swap = order[i];
+        order[i] = order[biggest];
+        order[biggest] = swap;
+
+        shards = runnerTests[order[i]] / minShard;
+        shards = (shards < 1) ? 1 : ((shards > jobs) ? jobs : shards);
+        for (shard = 1; shard <= shards; shard++)
+        {
+            if (!addTask(runners[order[i]], shard, shards, 0))
+                return 1;
+        }
+    }
+    runTasks(0, taskCount, jobs, finished);
+
+    printf("\n-----------------------\n");
+    printf("%u Tests %u Failures %u Ignored \n", totalTests, totalFailures + brokenRunners, totalIgnores);
+    printf("%s\n", ((totalFailures + brokenRunners) == 0) ? "OK" : "FAIL");
+    return ((totalFailures + brokenRunners) == 0) ? 0 : 1;
+}
@@ -0,0 +1,34 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#ifndef UNITY_PARALLEL_H_
+#define UNITY_PARALLEL_H_
+
+/* A runner is only split into shards of at least this many tests, unless
+ * --min-shard says otherwise */
+#ifndef UNITY_PARALLEL_MIN_SHARD
+#define UNITY_PARALLEL_MIN_SHARD 50
+#endif
+
+/* The most runners, shards run in all and runners run at once */
+#ifndef UNITY_PARALLEL_MAX_RUNNERS
+#define UNITY_PARALLEL_MAX_RUNNERS 1024
+#endif
+
+#ifndef UNITY_PARALLEL_MAX_TASKS
+#define UNITY_PARALLEL_MAX_TASKS 4096
+#endif
+
+#ifndef UNITY_PARALLEL_MAX_JOBS
+#define UNITY_PARALLEL_MAX_JOBS 256
+#endif
+
+/* The most options passed on to every runner after -- */
+#ifndef UNITY_PARALLEL_MAX_ARGS
+#define UNITY_PARALLEL_MAX_ARGS 32
+#endif
+
+#endif /* UNITY_PARALLEL_H_ */
@@ -0,0 +1,53 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#include "unity_parallel_Runner.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void test_One(void)
+{
+    TEST_PASS();
+}
+
+static void test_Two(void)
+{
+    TEST_PASS();
+}
+
+static void test_Three(void)
+{
+    TEST_FAIL_MESSAGE("This Test Should Fail");
+}
+
+static void test_Four(void)
+{
+    TEST_PASS();
+}
+
+static void test_Five(void)
+{
+    TEST_IGNORE();
+}
+
+static void test_Six(void)
+{
+    TEST_PASS();
+}
+
+RUNNER_MAIN("unity_parallel_Big.c",
+    RUNNER_TEST(test_One);
+    RUNNER_TEST(test_Two);
+    RUNNER_TEST(test_Three);
+    RUNNER_TEST(test_Four);
+    RUNNER_TEST(test_Five);
+    RUNNER_TEST(test_Six))
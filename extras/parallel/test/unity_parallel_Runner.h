@@ -0,0 +1,41 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+/* Just enough of a generated runner for these tests: it lists its tests for
+ * -l and leaves out those its options do not select, such as other shards. */
+
+#ifndef UNITY_PARALLEL_RUNNER_H_
+#define UNITY_PARALLEL_RUNNER_H_
+
+#include "unity.h"
+
+#define RUNNER_TEST(func) \
+    do { \
+        if (listing) { UnityPrint("  " #func); UNITY_PRINT_EOL(); } \
+        else { Unity.CurrentTestName = #func; if (UnityTestMatches()) UnityDefaultTestRun(func, #func, __LINE__); } \
+    } while (0)
+
+#define RUNNER_MAIN(file, tests) \
+    int main(int argc, char** argv) \
+    { \
+        int listing = 0; \
+        int status = UnityParseOptions(argc, argv); \
+        if (status > 0) \
+            return status; \
+        if (status < 0) \
+        { \
+            listing = 1; \
+            UnityPrint(file "."); \
+            UNITY_PRINT_EOL(); \
+            tests; \
+            return 0; \
+        } \
+        UnityBegin(file); \
+        tests; \
+        return UnityEnd(); \
+    }
+
+#endif /* UNITY_PARALLEL_RUNNER_H_ */
@@ -0,0 +1,23 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#include "unity_parallel_Runner.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void test_Alone(void)
+{
+    TEST_PASS();
+}
+
+RUNNER_MAIN("unity_parallel_Small.c",
+    RUNNER_TEST(test_Alone))
@@ -19,7 +19,7 @@ void UNITY_OUTPUT_CHAR(int);
 #endif
 
 /* Helpful macros for us to use here in Assert functions */
-#define UNITY_FAIL_AND_BAIL   { Unity.CurrentTestFailed  = 1; UNITY_OUTPUT_FLUSH(); TEST_ABORT(); }
+#define UNITY_FAIL_AND_BAIL   { if (UnityExpectationFailed()) { return; } Unity.CurrentTestFailed = 1; UNITY_OUTPUT_FLUSH(); TEST_ABORT(); }
 #define UNITY_IGNORE_AND_BAIL { Unity.CurrentTestIgnored = 1; UNITY_OUTPUT_FLUSH(); TEST_ABORT(); }
 #define RETURN_IF_FAIL_OR_IGNORE if (Unity.CurrentTestFailed || Unity.CurrentTestIgnored) return
 
@@ -46,10 +46,31 @@ static const char PROGMEM UnityStrOrEqual[]                = "or equal to ";
 static const char PROGMEM UnityStrElement[]                = " Element ";
 static const char PROGMEM UnityStrByte[]                   = " Byte ";
 static const char PROGMEM UnityStrMemory[]                 = " Memory Mismatch.";
+static const char PROGMEM UnityStrUnexpected[]             = " Unexpected ";
+static const char PROGMEM UnityStrMissing[]                = " Missing ";
+static const char PROGMEM UnityStrContain[]                = "To Contain ";
+static const char PROGMEM UnityStrStartWith[]              = "To Start With ";
+static const char PROGMEM UnityStrEndWith[]                = "To End With ";
+static const char PROGMEM UnityStrMatch[]                  = "To Match ";
+static const char PROGMEM UnityStrEllipsis[]               = "...";
+static const char PROGMEM UnityStrHash[]                   = " Memory Hash Mismatch.";
+#if (UNITY_ARRAY_SCRATCH_SLOTS > 0)
+static const char PROGMEM UnityStrScratchNeeds[]           = " Unordered Array Needs ";
+static const char PROGMEM UnityStrScratchSlots[]           = " Scratch Slots. Use _WITH_SCRATCH Or Raise UNITY_ARRAY_SCRATCH_SLOTS.";
+#endif
+#ifdef UNITY_INCLUDE_GOLDEN_FILE
+static const char PROGMEM UnityStrGolden[]                 = " Golden File Mismatch: ";
+static const char PROGMEM UnityStrGoldenOpen[]             = " Unable To Open Golden File: ";
+static const char PROGMEM UnityStrGoldenWrite[]            = " Unable To Write Golden File: ";
+static const char PROGMEM UnityStrGoldenReplace[]          = " Unable To Replace Golden File: ";
+static const char PROGMEM UnityStrGoldenLeftIn[]           = ". Update Left In ";
+static const char PROGMEM UnityStrLength[]                 = "Length ";
+#endif
 static const char PROGMEM UnityStrDelta[]                  = " Values Not Within Delta ";
 static const char PROGMEM UnityStrPointless[]              = " You Asked Me To Compare Nothing, Which Was Pointless.";
 static const char PROGMEM UnityStrNullPointerForExpected[] = " Expected pointer to be NULL";
 static const char PROGMEM UnityStrNullPointerForActual[]   = " Actual pointer was NULL";
+static const char PROGMEM UnityStrNullPointerForMask[]     = " Mask pointer was NULL";
 #ifndef UNITY_EXCLUDE_FLOAT
 static const char PROGMEM UnityStrNot[]                    = "Not ";
 static const char PROGMEM UnityStrInf[]                    = "Infinity";
@@ -62,10 +83,24 @@ const char PROGMEM UnityStrErrShorthand[]                  = "Unity Shorthand Su
 const char PROGMEM UnityStrErrFloat[]                      = "Unity Floating Point Disabled";
 const char PROGMEM UnityStrErrDouble[]                     = "Unity Double Precision Disabled";
 const char PROGMEM UnityStrErr64[]                         = "Unity 64-bit Support Disabled";
+const char PROGMEM UnityStrErrGoldenFile[]                 = "Unity Golden File Support Disabled";
+const char PROGMEM UnityStrErrGeneric[]                    = "Unity Generic Assertions Require C11";
 static const char PROGMEM UnityStrBreaker[]                = "-----------------------";
 static const char PROGMEM UnityStrResultsTests[]           = " Tests ";
 static const char PROGMEM UnityStrResultsFailures[]        = " Failures ";
 static const char PROGMEM UnityStrResultsIgnored[]         = " Ignored ";
+static const char PROGMEM UnityStrShard[]                  = "Shard ";
+static const char PROGMEM UnityStrShardOf[]                = " Of ";
+static const char PROGMEM UnityStrShardTests[]             = " Tests";
+static const char PROGMEM UnityStrSkippedBecause[]         = "Skipped Because ";
+static const char PROGMEM UnityStrSkippedFailed[]          = " Failed";
+static const char PROGMEM UnityStrFailFast[]               = "Stopped After ";
+static const char PROGMEM UnityStrFailFastFailures[]       = " Failures: ";
+static const char PROGMEM UnityStrFailFastSkipped[]        = " Tests Skipped";
+#ifdef UNITY_INCLUDE_RUN_STATE
+static const char PROGMEM UnityStrTimeBudget[]             = "Out Of Time After ";
+static const char PROGMEM UnityStrTimeBudgetSpent[]        = " ms: ";
+#endif
 static const char PROGMEM UnityStrDetail1Name[]            = UNITY_DETAIL1_NAME " ";
 static const char PROGMEM UnityStrDetail2Name[]            = " " UNITY_DETAIL2_NAME " ";
 
@@ -411,12 +446,13 @@ void UnityPrintNumberHex(const UNITY_UINT number, const char nibbles_to_print)
 }
 
 /*-----------------------------------------------*/
-void UnityPrintMask(const UNITY_UINT mask, const UNITY_UINT number)
+/* Local helper function to print the lowest bits of number, with X for bits outside mask. */
+static void UnityPrintMaskBits(const UNITY_UINT mask, const UNITY_UINT number, const UNITY_INT32 bits)
 {
-    UNITY_UINT current_bit = (UNITY_UINT)1 << (UNITY_INT_WIDTH - 1);
+    UNITY_UINT current_bit = (UNITY_UINT)1 << (bits - 1);
     UNITY_INT32 i;
 
-    for (i = 0; i < UNITY_INT_WIDTH; i++)
+    for (i = 0; i < bits; i++)
     {
         if (current_bit & mask)
         {
@@ -437,6 +473,12 @@ void UnityPrintMask(const UNITY_UINT mask, const UNITY_UINT number)
     }
 }
 
+/*-----------------------------------------------*/
+void UnityPrintMask(const UNITY_UINT mask, const UNITY_UINT number)
+{
+    UnityPrintMaskBits(mask, number, UNITY_INT_WIDTH);
+}
+
 /*-----------------------------------------------*/
 #ifndef UNITY_EXCLUDE_FLOAT_PRINT
 /*
@@ -650,14 +692,40 @@ static void UnityTestResultsFailBegin(const UNITY_LINE_TYPE line)
     UNITY_OUTPUT_CHAR(':');
 }
 
+/*-----------------------------------------------*/
+/* Called as an assertion fails. Inside a TEST_EXPECT_* the failure line is
+ * finished and the test keeps running, until UNITY_EXPECT_MAX_FAILURES of
+ * them have been reported. Returns 0 when the test should abort instead. */
+static int UnityExpectationFailed(void)
+{
+    if (!Unity.CurrentTestExpecting)
+    {
+        return 0;
+    }
+    if (Unity.CurrentTestExpectFailures >= UNITY_EXPECT_MAX_FAILURES)
+    {
+        Unity.CurrentTestExpecting = 0;
+        return 0;
+    }
+
+    Unity.CurrentTestExpectFailures++;
+    UNITY_PRINT_EOL();
+    UNITY_FLUSH_CALL();
+    return 1;
+}
+
 /*-----------------------------------------------*/
 void UnityConcludeTest(void)
 {
+    UNITY_SNAPSHOT_RESTORE();
+#ifdef UNITY_INCLUDE_RUN_STATE
+    UnityRunStateConcluded();
+#endif
     if (Unity.CurrentTestIgnored)
     {
         Unity.TestIgnores++;
     }
-    else if (!Unity.CurrentTestFailed)
+    else if (!Unity.CurrentTestFailed && (Unity.CurrentTestExpectFailures == 0))
     {
         UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
         UnityPrint(UnityStrPass);
@@ -667,10 +735,17 @@ void UnityConcludeTest(void)
         Unity.TestFailures++;
     }
 
+    /* Failed expectations have already ended their own lines */
+    if (Unity.CurrentTestIgnored || Unity.CurrentTestFailed || (Unity.CurrentTestExpectFailures == 0))
+    {
+        UNITY_PRINT_EXEC_TIME();
+        UNITY_PRINT_EOL();
+    }
+
     Unity.CurrentTestFailed = 0;
     Unity.CurrentTestIgnored = 0;
-    UNITY_PRINT_EXEC_TIME();
-    UNITY_PRINT_EOL();
+    Unity.CurrentTestExpecting = 0;
+    Unity.CurrentTestExpectFailures = 0;
     UNITY_FLUSH_CALL();
 }
 
@@ -791,6 +866,17 @@ static int UnityIsOneArrayNull(UNITY_INTERNAL_PTR expected,
  * Assertion Functions
  *-----------------------------------------------*/
 
+/*-----------------------------------------------*/
+static int UnityIsSameUnstridedArray(UNITY_INTERNAL_PTR expected,
+                                     UNITY_INTERNAL_PTR actual,
+                                     const UNITY_UINT32 stride,
+                                     const UNITY_UINT32 offset)
+{
+    /* a strided view of the expected array is not the expected array itself */
+    if (expected != actual) { return 0; }
+    return ((expected == NULL) || ((stride == 0) && (offset == 0)));
+}
+
 /*-----------------------------------------------*/
 void UnityAssertBits(const UNITY_INT mask,
                      const UNITY_INT expected,
@@ -887,6 +973,20 @@ void UnityAssertEqualIntArray(UNITY_INTERNAL_PTR expected,
                               const UNITY_LINE_TYPE lineNumber,
                               const UNITY_DISPLAY_STYLE_T style,
                               const UNITY_FLAGS_T flags)
+{
+    UnityAssertEqualIntArrayStrided(expected, actual, num_elements, 0, 0, msg, lineNumber, style, flags);
+}
+
+/*-----------------------------------------------*/
+void UnityAssertEqualIntArrayStrided(UNITY_INTERNAL_PTR expected,
+                                     UNITY_INTERNAL_PTR actual,
+                                     const UNITY_UINT32 num_elements,
+                                     const UNITY_UINT32 stride,
+                                     const UNITY_UINT32 offset,
+                                     const char* msg,
+                                     const UNITY_LINE_TYPE lineNumber,
+                                     const UNITY_DISPLAY_STYLE_T style,
+                                     const UNITY_FLAGS_T flags)
 {
     UNITY_UINT32 elements  = num_elements;
     unsigned int length    = style & 0xF;
@@ -899,7 +999,7 @@ void UnityAssertEqualIntArray(UNITY_INTERNAL_PTR expected,
         UnityPrintPointlessAndBail();
     }
 
-    if (expected == actual)
+    if (UnityIsSameUnstridedArray(expected, actual, stride, offset))
     {
         return; /* Both are NULL or same pointer */
     }
@@ -909,6 +1009,9 @@ void UnityAssertEqualIntArray(UNITY_INTERNAL_PTR expected,
         UNITY_FAIL_AND_BAIL;
     }
 
+    /* actual may be an array of structs; start at the field being checked */
+    actual = (UNITY_INTERNAL_PTR)((const char*)actual + offset);
+
     while ((elements > 0) && (elements--))
     {
         UNITY_INT expect_val;
@@ -969,7 +1072,7 @@ void UnityAssertEqualIntArray(UNITY_INTERNAL_PTR expected,
         {
             expected = (UNITY_INTERNAL_PTR)((const char*)expected + increment);
         }
-        actual = (UNITY_INTERNAL_PTR)((const char*)actual + increment);
+        actual = (UNITY_INTERNAL_PTR)((const char*)actual + ((stride != 0) ? stride : increment));
     }
 }
 
@@ -1016,10 +1119,24 @@ void UnityAssertEqualFloatArray(UNITY_PTR_ATTRIBUTE const UNITY_FLOAT* expected,
                                 const char* msg,
                                 const UNITY_LINE_TYPE lineNumber,
                                 const UNITY_FLAGS_T flags)
+{
+    UnityAssertEqualFloatArrayStrided(expected, (UNITY_INTERNAL_PTR)actual, num_elements, 0, 0, msg, lineNumber, flags);
+}
+
+/*-----------------------------------------------*/
+void UnityAssertEqualFloatArrayStrided(UNITY_PTR_ATTRIBUTE const UNITY_FLOAT* expected,
+                                       UNITY_INTERNAL_PTR actual,
+                                       const UNITY_UINT32 num_elements,
+                                       const UNITY_UINT32 stride,
+                                       const UNITY_UINT32 offset,
+                                       const char* msg,
+                                       const UNITY_LINE_TYPE lineNumber,
+                                       const UNITY_FLAGS_T flags)
 {
     UNITY_UINT32 elements = num_elements;
     UNITY_PTR_ATTRIBUTE const UNITY_FLOAT* ptr_expected = expected;
-    UNITY_PTR_ATTRIBUTE const UNITY_FLOAT* ptr_actual = actual;
+    UNITY_PTR_ATTRIBUTE const char* ptr_actual = (UNITY_PTR_ATTRIBUTE const char*)actual;
+    const UNITY_UINT32 increment = (stride != 0) ? stride : (UNITY_UINT32)sizeof(UNITY_FLOAT);
 
     RETURN_IF_FAIL_OR_IGNORE;
 
@@ -1028,24 +1145,27 @@ void UnityAssertEqualFloatArray(UNITY_PTR_ATTRIBUTE const UNITY_FLOAT* expected,
         UnityPrintPointlessAndBail();
     }
 
-    if (expected == actual)
+    if (UnityIsSameUnstridedArray((UNITY_INTERNAL_PTR)expected, actual, stride, offset))
     {
         return; /* Both are NULL or same pointer */
     }
 
-    if (UnityIsOneArrayNull((UNITY_INTERNAL_PTR)expected, (UNITY_INTERNAL_PTR)actual, lineNumber, msg))
+    if (UnityIsOneArrayNull((UNITY_INTERNAL_PTR)expected, actual, lineNumber, msg))
     {
         UNITY_FAIL_AND_BAIL;
     }
 
+    ptr_actual += offset;
     while (elements--)
     {
-        if (!UnityFloatsWithin(*ptr_expected * UNITY_FLOAT_PRECISION, *ptr_expected, *ptr_actual))
+        const UNITY_FLOAT actual_val = *(UNITY_PTR_ATTRIBUTE const UNITY_FLOAT*)ptr_actual;
+
+        if (!UnityFloatsWithin(*ptr_expected * UNITY_FLOAT_PRECISION, *ptr_expected, actual_val))
         {
             UnityTestResultsFailBegin(lineNumber);
             UnityPrint(UnityStrElement);
             UnityPrintNumberUnsigned(num_elements - elements - 1);
-            UNITY_PRINT_EXPECTED_AND_ACTUAL_FLOAT((UNITY_DOUBLE)*ptr_expected, (UNITY_DOUBLE)*ptr_actual);
+            UNITY_PRINT_EXPECTED_AND_ACTUAL_FLOAT((UNITY_DOUBLE)*ptr_expected, (UNITY_DOUBLE)actual_val);
             UnityAddMsgIfSpecified(msg);
             UNITY_FAIL_AND_BAIL;
         }
@@ -1053,7 +1173,7 @@ void UnityAssertEqualFloatArray(UNITY_PTR_ATTRIBUTE const UNITY_FLOAT* expected,
         {
             ptr_expected++;
         }
-        ptr_actual++;
+        ptr_actual += increment;
     }
 }
 
@@ -1157,10 +1277,24 @@ void UnityAssertEqualDoubleArray(UNITY_PTR_ATTRIBUTE const UNITY_DOUBLE* expecte
                                  const char* msg,
                                  const UNITY_LINE_TYPE lineNumber,
                                  const UNITY_FLAGS_T flags)
+{
+    UnityAssertEqualDoubleArrayStrided(expected, (UNITY_INTERNAL_PTR)actual, num_elements, 0, 0, msg, lineNumber, flags);
+}
+
+/*-----------------------------------------------*/
+void UnityAssertEqualDoubleArrayStrided(UNITY_PTR_ATTRIBUTE const UNITY_DOUBLE* expected,
+                                        UNITY_INTERNAL_PTR actual,
+                                        const UNITY_UINT32 num_elements,
+                                        const UNITY_UINT32 stride,
+                                        const UNITY_UINT32 offset,
+                                        const char* msg,
+                                        const UNITY_LINE_TYPE lineNumber,
+                                        const UNITY_FLAGS_T flags)
 {
     UNITY_UINT32 elements = num_elements;
     UNITY_PTR_ATTRIBUTE const UNITY_DOUBLE* ptr_expected = expected;
-    UNITY_PTR_ATTRIBUTE const UNITY_DOUBLE* ptr_actual = actual;
+    UNITY_PTR_ATTRIBUTE const char* ptr_actual = (UNITY_PTR_ATTRIBUTE const char*)actual;
+    const UNITY_UINT32 increment = (stride != 0) ? stride : (UNITY_UINT32)sizeof(UNITY_DOUBLE);
 
     RETURN_IF_FAIL_OR_IGNORE;
 
@@ -1169,24 +1303,27 @@ void UnityAssertEqualDoubleArray(UNITY_PTR_ATTRIBUTE const UNITY_DOUBLE* expecte
         UnityPrintPointlessAndBail();
     }
 
-    if (expected == actual)
+    if (UnityIsSameUnstridedArray((UNITY_INTERNAL_PTR)expected, actual, stride, offset))
     {
         return; /* Both are NULL or same pointer */
     }
 
-    if (UnityIsOneArrayNull((UNITY_INTERNAL_PTR)expected, (UNITY_INTERNAL_PTR)actual, lineNumber, msg))
+    if (UnityIsOneArrayNull((UNITY_INTERNAL_PTR)expected, actual, lineNumber, msg))
     {
         UNITY_FAIL_AND_BAIL;
     }
 
+    ptr_actual += offset;
     while (elements--)
     {
-        if (!UnityDoublesWithin(*ptr_expected * UNITY_DOUBLE_PRECISION, *ptr_expected, *ptr_actual))
+        const UNITY_DOUBLE actual_val = *(UNITY_PTR_ATTRIBUTE const UNITY_DOUBLE*)ptr_actual;
+
+        if (!UnityDoublesWithin(*ptr_expected * UNITY_DOUBLE_PRECISION, *ptr_expected, actual_val))
         {
             UnityTestResultsFailBegin(lineNumber);
             UnityPrint(UnityStrElement);
             UnityPrintNumberUnsigned(num_elements - elements - 1);
-            UNITY_PRINT_EXPECTED_AND_ACTUAL_FLOAT(*ptr_expected, *ptr_actual);
+            UNITY_PRINT_EXPECTED_AND_ACTUAL_FLOAT(*ptr_expected, actual_val);
             UnityAddMsgIfSpecified(msg);
             UNITY_FAIL_AND_BAIL;
         }
@@ -1194,7 +1331,7 @@ void UnityAssertEqualDoubleArray(UNITY_PTR_ATTRIBUTE const UNITY_DOUBLE* expecte
         {
             ptr_expected++;
         }
-        ptr_actual++;
+        ptr_actual += increment;
     }
 }
 
@@ -1338,6 +1475,21 @@ void UnityAssertNumbersArrayWithin(const UNITY_UINT delta,
                                    const UNITY_LINE_TYPE lineNumber,
                                    const UNITY_DISPLAY_STYLE_T style,
                                    const UNITY_FLAGS_T flags)
+{
+    UnityAssertNumbersArrayWithinStrided(delta, expected, actual, num_elements, 0, 0, msg, lineNumber, style, flags);
+}
+
+/*-----------------------------------------------*/
+void UnityAssertNumbersArrayWithinStrided(const UNITY_UINT delta,
+                                          UNITY_INTERNAL_PTR expected,
+                                          UNITY_INTERNAL_PTR actual,
+                                          const UNITY_UINT32 num_elements,
+                                          const UNITY_UINT32 stride,
+                                          const UNITY_UINT32 offset,
+                                          const char* msg,
+                                          const UNITY_LINE_TYPE lineNumber,
+                                          const UNITY_DISPLAY_STYLE_T style,
+                                          const UNITY_FLAGS_T flags)
 {
     UNITY_UINT32 elements = num_elements;
     unsigned int length   = style & 0xF;
@@ -1350,7 +1502,7 @@ void UnityAssertNumbersArrayWithin(const UNITY_UINT delta,
         UnityPrintPointlessAndBail();
     }
 
-    if (expected == actual)
+    if (UnityIsSameUnstridedArray(expected, actual, stride, offset))
     {
         return; /* Both are NULL or same pointer */
     }
@@ -1360,6 +1512,8 @@ void UnityAssertNumbersArrayWithin(const UNITY_UINT delta,
         UNITY_FAIL_AND_BAIL;
     }
 
+    actual = (UNITY_INTERNAL_PTR)((const char*)actual + offset);
+
     while ((elements > 0) && (elements--))
     {
         UNITY_INT expect_val;
@@ -1445,7 +1599,7 @@ void UnityAssertNumbersArrayWithin(const UNITY_UINT delta,
         {
             expected = (UNITY_INTERNAL_PTR)((const char*)expected + increment);
         }
-        actual = (UNITY_INTERNAL_PTR)((const char*)actual + increment);
+        actual = (UNITY_INTERNAL_PTR)((const char*)actual + ((stride != 0) ? stride : increment));
     }
 }
 
@@ -1456,6 +1610,7 @@ void UnityAssertEqualString(const char* expected,
                             const UNITY_LINE_TYPE lineNumber)
 {
     UNITY_UINT32 i;
+    int failed = 0;
 
     RETURN_IF_FAIL_OR_IGNORE;
 
@@ -1466,7 +1621,7 @@ void UnityAssertEqualString(const char* expected,
         {
             if (expected[i] != actual[i])
             {
-                Unity.CurrentTestFailed = 1;
+                failed = 1;
                 break;
             }
         }
@@ -1475,11 +1630,11 @@ void UnityAssertEqualString(const char* expected,
     { /* handle case of one pointers being null (if both null, test should pass) */
         if (expected != actual)
         {
-            Unity.CurrentTestFailed = 1;
+            failed = 1;
         }
     }
 
-    if (Unity.CurrentTestFailed)
+    if (failed)
     {
         UnityTestResultsFailBegin(lineNumber);
         UnityPrintExpectedAndActualStrings(expected, actual);
@@ -1496,6 +1651,7 @@ void UnityAssertEqualStringLen(const char* expected,
                                const UNITY_LINE_TYPE lineNumber)
 {
     UNITY_UINT32 i;
+    int failed = 0;
 
     RETURN_IF_FAIL_OR_IGNORE;
 
@@ -1506,7 +1662,7 @@ void UnityAssertEqualStringLen(const char* expected,
         {
             if (expected[i] != actual[i])
             {
-                Unity.CurrentTestFailed = 1;
+                failed = 1;
                 break;
             }
         }
@@ -1515,11 +1671,11 @@ void UnityAssertEqualStringLen(const char* expected,
     { /* handle case of one pointers being null (if both null, test should pass) */
         if (expected != actual)
         {
-            Unity.CurrentTestFailed = 1;
+            failed = 1;
         }
     }
 
-    if (Unity.CurrentTestFailed)
+    if (failed)
     {
         UnityTestResultsFailBegin(lineNumber);
         UnityPrintExpectedAndActualStringsLen(expected, actual, length);
@@ -1528,6 +1684,282 @@ void UnityAssertEqualStringLen(const char* expected,
     }
 }
 
+/*-----------------------------------------------
+ * String Search Assertions
+ *-----------------------------------------------*/
+
+/* Maximal suffix of needle under < (or > when reversed); sets the period of that suffix.
+ * Returns the index just before the suffix starts, so -1 means the whole needle. */
+static UNITY_INT UnityMaximalSuffix(const char* needle, const UNITY_INT length, UNITY_INT* period, const int reversed)
+{
+    UNITY_INT suffix = -1;
+    UNITY_INT j = 0;
+    UNITY_INT k = 1;
+    unsigned char a;
+    unsigned char b;
+
+    *period = 1;
+    while ((j + k) < length)
+    {
+        a = (unsigned char)needle[j + k];
+        b = (unsigned char)needle[suffix + k];
+        if (reversed ? (a > b) : (a < b))
+        {
+            j += k;
+            k = 1;
+            *period = j - suffix;
+        }
+        else if (a == b)
+        {
+            if (k != *period)
+            {
+                k++;
+            }
+            else
+            {
+                j += *period;
+                k = 1;
+            }
+        }
+        else
+        {
+            suffix = j++;
+            k = 1;
+            *period = 1;
+        }
+    }
+    return suffix;
+}
+
+/*-----------------------------------------------*/
+/* Crochemore-Perrin Two-Way search: linear time, constant space, no allocation.
+ * Returns the offset of the first occurrence of needle in haystack, or -1. */
+static UNITY_INT UnityFindSubstring(const char* haystack, const UNITY_INT haystack_length,
+                                    const char* needle, const UNITY_INT needle_length)
+{
+    UNITY_INT critical;
+    UNITY_INT period;
+    UNITY_INT other_period;
+    UNITY_INT other_critical;
+    UNITY_UINT left;
+    UNITY_UINT right;
+    UNITY_INT memory = -1;
+    UNITY_INT i;
+    UNITY_INT j = 0;
+    int periodic = 1;
+
+    if (needle_length == 0)
+    {
+        return 0;
+    }
+
+    critical       = UnityMaximalSuffix(needle, needle_length, &period, 0);
+    other_critical = UnityMaximalSuffix(needle, needle_length, &other_period, 1);
+    if (other_critical > critical)
+    {
+        critical = other_critical;
+        period   = other_period;
+    }
+
+    /* needle is periodic if its left part repeats one period further on */
+    for (i = 0; (i <= critical) && periodic; i++)
+    {
+        periodic = ((period + i) < needle_length) && (needle[i] == needle[period + i]);
+    }
+    if (!periodic)
+    {
+        /* the larger half plus one, in unsigned so critical == -1 needs no signed +1 */
+        left  = (UNITY_UINT)critical + 1u;
+        right = (UNITY_UINT)needle_length - left;
+        period = (UNITY_INT)(((left > right) ? left : right) + 1u);
+    }
+
+    while (j <= (haystack_length - needle_length))
+    {
+        /* scan the right half forwards, resuming past any prefix already known to match */
+        i = ((memory > critical) ? memory : critical) + 1;
+        while ((i < needle_length) && (needle[i] == haystack[i + j]))
+        {
+            i++;
+        }
+        if (i < needle_length)
+        {
+            j += i - critical;
+            memory = -1;
+            continue;
+        }
+
+        /* then the left half backwards */
+        i = critical;
+        while ((i > memory) && (needle[i] == haystack[i + j]))
+        {
+            i--;
+        }
+        if (i <= memory)
+        {
+            return j;
+        }
+        j += period;
+        memory = periodic ? (needle_length - period - 1) : -1;
+    }
+    return -1;
+}
+
+/*-----------------------------------------------*/
+/* Glob match supporting '*' (any run of characters) and '?' (any one character).
+ * Backtracks only to the most recent '*', so it never goes exponential. */
+static int UnityGlobMatches(const char* pattern, const char* string)
+{
+    const char* star = NULL;
+    const char* resume = string;
+
+    while (*string != '\0')
+    {
+        if (*pattern == '*')
+        {
+            star = ++pattern;
+            resume = string;
+        }
+        else if ((*pattern == '?') || (*pattern == *string))
+        {
+            pattern++;
+            string++;
+        }
+        else if (star != NULL)
+        {
+            pattern = star;
+            string = ++resume;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    while (*pattern == '*')
+    {
+        pattern++;
+    }
+    return *pattern == '\0';
+}
+
+/*-----------------------------------------------*/
+static UNITY_INT UnityStringLength(const char* string)
+{
+    const char* end = string;
+
+    while (*end != '\0')
+    {
+        end++;
+    }
+    return (UNITY_INT)(end - string);
+}
+
+/*-----------------------------------------------*/
+static int UnityStringPrefixMatches(const char* prefix, const char* string, const UNITY_INT length)
+{
+    UNITY_INT i;
+
+    for (i = 0; i < length; i++)
+    {
+        if (prefix[i] != string[i])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*-----------------------------------------------*/
+/* Prints at most UNITY_STRING_WINDOW_LENGTH characters of a long string, from its start or end */
+static void UnityPrintStringWindow(const char* string, const UNITY_INT length, const int from_end)
+{
+    UNITY_OUTPUT_CHAR('\'');
+    if (length <= UNITY_STRING_WINDOW_LENGTH)
+    {
+        UnityPrintLen(string, (UNITY_UINT32)length);
+    }
+    else if (from_end)
+    {
+        UnityPrint(UnityStrEllipsis);
+        UnityPrintLen(string + length - UNITY_STRING_WINDOW_LENGTH, UNITY_STRING_WINDOW_LENGTH);
+    }
+    else
+    {
+        UnityPrintLen(string, UNITY_STRING_WINDOW_LENGTH);
+        UnityPrint(UnityStrEllipsis);
+    }
+    UNITY_OUTPUT_CHAR('\'');
+}
+
+/*-----------------------------------------------*/
+void UnityAssertStringSearch(const char* expected,
+                             const char* actual,
+                             const char* msg,
+                             const UNITY_LINE_TYPE lineNumber,
+                             const UNITY_STRING_SEARCH_T search)
+{
+    UNITY_INT expected_length;
+    UNITY_INT actual_length;
+    int found = 0;
+    const char* description;
+
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    if (expected == actual)
+    {
+        return; /* Both are NULL or same pointer */
+    }
+
+    if (UnityIsOneArrayNull((UNITY_INTERNAL_PTR)expected, (UNITY_INTERNAL_PTR)actual, lineNumber, msg))
+    {
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    expected_length = UnityStringLength(expected);
+    actual_length   = UnityStringLength(actual);
+
+    switch (search)
+    {
+        case UNITY_STRING_STARTS_WITH:
+            description = UnityStrStartWith;
+            found = (expected_length <= actual_length) &&
+                    UnityStringPrefixMatches(expected, actual, expected_length);
+            break;
+
+        case UNITY_STRING_ENDS_WITH:
+            description = UnityStrEndWith;
+            found = (expected_length <= actual_length) &&
+                    UnityStringPrefixMatches(expected, actual + actual_length - expected_length, expected_length);
+            break;
+
+        case UNITY_STRING_MATCHES_GLOB:
+            description = UnityStrMatch;
+            found = UnityGlobMatches(expected, actual);
+            break;
+
+        case UNITY_STRING_CONTAINS:
+        default:
+            description = UnityStrContain;
+            found = (UnityFindSubstring(actual, actual_length, expected, expected_length) >= 0);
+            break;
+    }
+
+    if (!found)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrExpected);
+        UnityPrint(description);
+        UNITY_OUTPUT_CHAR('\'');
+        UnityPrint(expected);
+        UNITY_OUTPUT_CHAR('\'');
+        UnityPrint(UnityStrWas);
+        UnityPrintStringWindow(actual, actual_length, search == UNITY_STRING_ENDS_WITH);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+}
+
 /*-----------------------------------------------*/
 void UnityAssertEqualStringArray(UNITY_INTERNAL_PTR expected,
                                  const char** actual,
@@ -1540,6 +1972,7 @@ void UnityAssertEqualStringArray(UNITY_INTERNAL_PTR expected,
     UNITY_UINT32 j = 0;
     const char* expd = NULL;
     const char* act = NULL;
+    int failed = 0;
 
     RETURN_IF_FAIL_OR_IGNORE;
 
@@ -1579,7 +2012,7 @@ void UnityAssertEqualStringArray(UNITY_INTERNAL_PTR expected,
             {
                 if (expd[i] != act[i])
                 {
-                    Unity.CurrentTestFailed = 1;
+                    failed = 1;
                     break;
                 }
             }
@@ -1588,11 +2021,11 @@ void UnityAssertEqualStringArray(UNITY_INTERNAL_PTR expected,
         { /* handle case of one pointers being null (if both null, test should pass) */
             if (expd != act)
             {
-                Unity.CurrentTestFailed = 1;
+                failed = 1;
             }
         }
 
-        if (Unity.CurrentTestFailed)
+        if (failed)
         {
             UnityTestResultsFailBegin(lineNumber);
             if (num_elements > 1)
@@ -1607,52 +2040,587 @@ void UnityAssertEqualStringArray(UNITY_INTERNAL_PTR expected,
     } while (++j < num_elements);
 }
 
+/*-----------------------------------------------
+ * Unordered and Sorted Array Assertions
+ *-----------------------------------------------*/
+
+/* Describes one side of an unordered comparison. Integer arrays use the byte
+ * length from their display style; string arrays (length 0) hold char pointers. */
+typedef struct
+{
+    UNITY_INTERNAL_PTR array;
+    UNITY_UINT32 count;
+    unsigned int length;
+} UNITY_UNORDERED_ARRAY_T;
+
+#if (UNITY_ARRAY_SCRATCH_SLOTS > 0)
+/* Scratch space for the multiset when the caller passes none: slot i holds 1 + the
+ * index of the first expected element with that value (0 when empty) and the count
+ * still unmatched. */
+static UNITY_ARRAY_SCRATCH_T UnityUnorderedScratch[UNITY_ARRAY_SCRATCH_SLOTS];
+#endif
+
+static UNITY_INT UnityReadIntElement(UNITY_INTERNAL_PTR array, const UNITY_UINT32 index, const unsigned int length)
+{
+    switch (length)
+    {
+        case 1:  return ((UNITY_PTR_ATTRIBUTE const UNITY_INT8*)array)[index];
+        case 2:  return ((UNITY_PTR_ATTRIBUTE const UNITY_INT16*)array)[index];
+#ifdef UNITY_SUPPORT_64
+        case 8:  return ((UNITY_PTR_ATTRIBUTE const UNITY_INT64*)array)[index];
+#endif
+        default: return ((UNITY_PTR_ATTRIBUTE const UNITY_INT32*)array)[index];
+    }
+}
+
 /*-----------------------------------------------*/
-void UnityAssertEqualMemory(UNITY_INTERNAL_PTR expected,
-                            UNITY_INTERNAL_PTR actual,
-                            const UNITY_UINT32 length,
-                            const UNITY_UINT32 num_elements,
-                            const char* msg,
-                            const UNITY_LINE_TYPE lineNumber,
-                            const UNITY_FLAGS_T flags)
+static const char* UnityReadStringElement(const UNITY_UNORDERED_ARRAY_T* side, const UNITY_UINT32 index)
 {
-    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_exp = (UNITY_PTR_ATTRIBUTE const unsigned char*)expected;
-    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_act = (UNITY_PTR_ATTRIBUTE const unsigned char*)actual;
-    UNITY_UINT32 elements = num_elements;
-    UNITY_UINT32 bytes;
+    return ((const char* const*)side->array)[index];
+}
 
-    RETURN_IF_FAIL_OR_IGNORE;
+/*-----------------------------------------------*/
+static int UnityUnorderedElementsEqual(const UNITY_UNORDERED_ARRAY_T* a, const UNITY_UINT32 ia,
+                                       const UNITY_UNORDERED_ARRAY_T* b, const UNITY_UINT32 ib)
+{
+    const char* sa;
+    const char* sb;
 
-    if ((elements == 0) || (length == 0))
+    if (a->length != 0)
     {
-        UnityPrintPointlessAndBail();
+        return UnityReadIntElement(a->array, ia, a->length) == UnityReadIntElement(b->array, ib, b->length);
     }
 
-    if (expected == actual)
+    sa = UnityReadStringElement(a, ia);
+    sb = UnityReadStringElement(b, ib);
+    if ((sa == NULL) || (sb == NULL))
     {
-        return; /* Both are NULL or same pointer */
+        return sa == sb;
     }
+    while ((*sa != '\0') && (*sa == *sb))
+    {
+        sa++;
+        sb++;
+    }
+    return *sa == *sb;
+}
 
-    if (UnityIsOneArrayNull(expected, actual, lineNumber, msg))
+/*-----------------------------------------------*/
+static UNITY_UINT32 UnityUnorderedCountMatches(const UNITY_UNORDERED_ARRAY_T* side, const UNITY_UINT32 limit,
+                                               const UNITY_UNORDERED_ARRAY_T* item_side, const UNITY_UINT32 item)
+{
+    UNITY_UINT32 matches = 0;
+    UNITY_UINT32 i;
+
+    for (i = 0; i < limit; i++)
     {
-        UNITY_FAIL_AND_BAIL;
+        if (UnityUnorderedElementsEqual(side, i, item_side, item))
+        {
+            matches++;
+        }
     }
+    return matches;
+}
 
-    while (elements--)
+/*-----------------------------------------------*/
+static UNITY_UINT32 UnityUnorderedHash(const UNITY_UNORDERED_ARRAY_T* side, const UNITY_UINT32 index)
+{
+    UNITY_UINT32 hash = 2166136261u; /* FNV-1a */
+    const char* str;
+    UNITY_UINT value;
+    unsigned int i;
+
+    if (side->length != 0)
     {
-        bytes = length;
-        while (bytes--)
+        value = (UNITY_UINT)UnityReadIntElement(side->array, index, side->length);
+        for (i = 0; i < sizeof(value); i++)
         {
-            if (*ptr_exp != *ptr_act)
-            {
-                UnityTestResultsFailBegin(lineNumber);
-                UnityPrint(UnityStrMemory);
-                if (num_elements > 1)
-                {
-                    UnityPrint(UnityStrElement);
-                    UnityPrintNumberUnsigned(num_elements - elements - 1);
-                }
-                UnityPrint(UnityStrByte);
+            hash = (hash ^ (UNITY_UINT32)(value & 0xFF)) * 16777619u;
+            value >>= 8;
+        }
+        return hash;
+    }
+
+    str = UnityReadStringElement(side, index);
+    if (str != NULL)
+    {
+        while (*str != '\0')
+        {
+            hash = (hash ^ (UNITY_UINT32)(unsigned char)*str++) * 16777619u;
+        }
+    }
+    return hash;
+}
+
+/*-----------------------------------------------*/
+/* Returns the slot holding the value of item, or the empty slot where it belongs. */
+static UNITY_UINT32 UnityUnorderedFindSlot(const UNITY_ARRAY_SCRATCH_T* table,
+                                           const UNITY_UNORDERED_ARRAY_T* expected,
+                                           const UNITY_UNORDERED_ARRAY_T* item_side,
+                                           const UNITY_UINT32 item,
+                                           const UNITY_UINT32 mask)
+{
+    UNITY_UINT32 slot = UnityUnorderedHash(item_side, item) & mask;
+
+    while ((table[slot].Index != 0) &&
+           !UnityUnorderedElementsEqual(expected, table[slot].Index - 1, item_side, item))
+    {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+/*-----------------------------------------------*/
+/* Open-addressed multiset of expected, then one pass over actual: O(n) on average. */
+static void UnityUnorderedMatchHashed(UNITY_ARRAY_SCRATCH_T* table,
+                                      const UNITY_UNORDERED_ARRAY_T* expected,
+                                      const UNITY_UNORDERED_ARRAY_T* actual,
+                                      const UNITY_UINT32 capacity,
+                                      UNITY_UINT32* extra,
+                                      UNITY_UINT32* missing)
+{
+    const UNITY_UINT32 mask = capacity - 1;
+    UNITY_UINT32 slot;
+    UNITY_UINT32 i;
+
+    for (i = 0; i < capacity; i++)
+    {
+        table[i].Index = 0;
+        table[i].Count = 0;
+    }
+
+    for (i = 0; i < expected->count; i++)
+    {
+        slot = UnityUnorderedFindSlot(table, expected, expected, i, mask);
+        if (table[slot].Index == 0)
+        {
+            table[slot].Index = i + 1;
+        }
+        table[slot].Count++;
+    }
+
+    for (i = 0; i < actual->count; i++)
+    {
+        slot = UnityUnorderedFindSlot(table, expected, actual, i, mask);
+        if (table[slot].Count > 0)
+        {
+            table[slot].Count--;
+        }
+        else if (*extra == actual->count)
+        {
+            *extra = i;
+        }
+    }
+
+    for (i = 0; (i < expected->count) && (*missing == expected->count); i++)
+    {
+        slot = UnityUnorderedFindSlot(table, expected, expected, i, mask);
+        if (table[slot].Count > 0)
+        {
+            *missing = i;
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+/* Scratch-free fallback used when expected does not fit in any scratch table: O(n^2). */
+static void UnityUnorderedMatchCounting(const UNITY_UNORDERED_ARRAY_T* expected,
+                                        const UNITY_UNORDERED_ARRAY_T* actual,
+                                        UNITY_UINT32* extra,
+                                        UNITY_UINT32* missing)
+{
+    UNITY_UINT32 i;
+
+    for (i = 0; (i < actual->count) && (*extra == actual->count); i++)
+    {
+        if (UnityUnorderedCountMatches(actual, i + 1, actual, i) >
+            UnityUnorderedCountMatches(expected, expected->count, actual, i))
+        {
+            *extra = i;
+        }
+    }
+
+    for (i = 0; (i < expected->count) && (*missing == expected->count); i++)
+    {
+        if ((UnityUnorderedCountMatches(expected, i, expected, i) == 0) &&
+            (UnityUnorderedCountMatches(expected, expected->count, expected, i) >
+             UnityUnorderedCountMatches(actual, actual->count, expected, i)))
+        {
+            *missing = i;
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+static void UnityPrintQuotedString(const char* string)
+{
+    if (string == NULL)
+    {
+        UnityPrint(UnityStrNull);
+        return;
+    }
+    UNITY_OUTPUT_CHAR('\'');
+    UnityPrint(string);
+    UNITY_OUTPUT_CHAR('\'');
+}
+
+/*-----------------------------------------------*/
+static void UnityPrintUnorderedElement(const UNITY_UNORDERED_ARRAY_T* side,
+                                       const UNITY_UINT32 index,
+                                       const UNITY_DISPLAY_STYLE_T style)
+{
+    UNITY_INT value;
+    UNITY_INT mask = 1;
+
+    if (side->length == 0)
+    {
+        UnityPrintQuotedString(UnityReadStringElement(side, index));
+        return;
+    }
+
+    value = UnityReadIntElement(side->array, index, side->length);
+    if ((style & UNITY_DISPLAY_RANGE_UINT) && (side->length < (UNITY_INT_WIDTH / 8)))
+    {   /* For UINT, remove sign extension (padding 1's) from signed type casts above */
+        mask = (mask << 8 * side->length) - 1;
+        value &= mask;
+    }
+    UnityPrintNumberByStyle(value, style);
+}
+
+/*-----------------------------------------------*/
+static void UnityAssertUnordered(const UNITY_UNORDERED_ARRAY_T* expected,
+                                 const UNITY_UNORDERED_ARRAY_T* actual,
+                                 const char* msg,
+                                 const UNITY_LINE_TYPE lineNumber,
+                                 const UNITY_DISPLAY_STYLE_T style,
+                                 UNITY_ARRAY_SCRATCH_T* scratch,
+                                 UNITY_UINT32 scratch_slots)
+{
+    UNITY_UINT32 extra = actual->count;
+    UNITY_UINT32 missing = expected->count;
+    UNITY_UINT32 capacity = 1;
+    int static_scratch = 0;
+
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    if (actual->count == 0)
+    {
+        /* nothing is always a subset, but a permutation of nothing is pointless */
+        if (expected->count == 0)
+        {
+            UnityPrintPointlessAndBail();
+        }
+        return;
+    }
+
+    if (UnityIsOneArrayNull(expected->array, actual->array, lineNumber, msg))
+    {
+        UNITY_FAIL_AND_BAIL;
+    }
+
+#if (UNITY_ARRAY_SCRATCH_SLOTS > 0)
+    if (scratch == NULL)
+    {
+        scratch = UnityUnorderedScratch;
+        scratch_slots = UNITY_ARRAY_SCRATCH_SLOTS;
+        static_scratch = 1;
+    }
+#endif
+    if (scratch == NULL)
+    {
+        scratch_slots = 0;
+    }
+
+    /* aim for a table at most half full so probe chains stay short, but take
+     * whatever power of two fits the scratch as long as one slot stays empty */
+    while ((capacity < (2 * expected->count)) && ((capacity * 2) <= scratch_slots))
+    {
+        capacity <<= 1;
+    }
+    if ((capacity <= scratch_slots) && (capacity > expected->count))
+    {
+        UnityUnorderedMatchHashed(scratch, expected, actual, capacity, &extra, &missing);
+    }
+    else if (!static_scratch)
+    {
+        /* the caller chose this scratch, or none at all */
+        UnityUnorderedMatchCounting(expected, actual, &extra, &missing);
+    }
+#if (UNITY_ARRAY_SCRATCH_SLOTS > 0)
+    else
+    {
+        /* rather than quietly comparing every pair, say what would keep it fast */
+        while ((capacity <= expected->count) && (capacity != 0))
+        {
+            capacity <<= 1;
+        }
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrScratchNeeds);
+        UnityPrintNumberUnsigned(capacity);
+        UnityPrint(UnityStrScratchSlots);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+#endif
+
+    if (extra == actual->count)
+    {
+        return;
+    }
+
+    UnityTestResultsFailBegin(lineNumber);
+    UnityPrint(UnityStrElement);
+    UnityPrintNumberUnsigned(extra);
+    UnityPrint(UnityStrUnexpected);
+    UnityPrintUnorderedElement(actual, extra, style);
+    if ((expected->count == actual->count) && (missing < expected->count))
+    {
+        UnityPrint(UnityStrMissing);
+        UnityPrintUnorderedElement(expected, missing, style);
+    }
+    UnityAddMsgIfSpecified(msg);
+    UNITY_FAIL_AND_BAIL;
+}
+
+/*-----------------------------------------------*/
+void UnityAssertIntArrayUnordered(UNITY_INTERNAL_PTR expected,
+                                  UNITY_INTERNAL_PTR actual,
+                                  const UNITY_UINT32 expected_elements,
+                                  const UNITY_UINT32 actual_elements,
+                                  const char* msg,
+                                  const UNITY_LINE_TYPE lineNumber,
+                                  const UNITY_DISPLAY_STYLE_T style,
+                                  UNITY_ARRAY_SCRATCH_T* scratch,
+                                  const UNITY_UINT32 scratch_slots)
+{
+    UNITY_UNORDERED_ARRAY_T exp_side;
+    UNITY_UNORDERED_ARRAY_T act_side;
+    unsigned int length = style & 0xF;
+
+    if ((length != 1) && (length != 2) && (length != 8))
+    {
+        length = 4;
+    }
+
+    exp_side.array  = expected;
+    exp_side.count  = expected_elements;
+    exp_side.length = length;
+    act_side.array  = actual;
+    act_side.count  = actual_elements;
+    act_side.length = length;
+
+    UnityAssertUnordered(&exp_side, &act_side, msg, lineNumber, style, scratch, scratch_slots);
+}
+
+/*-----------------------------------------------*/
+void UnityAssertStringArrayUnordered(const char** expected,
+                                     const char** actual,
+                                     const UNITY_UINT32 expected_elements,
+                                     const UNITY_UINT32 actual_elements,
+                                     const char* msg,
+                                     const UNITY_LINE_TYPE lineNumber,
+                                     UNITY_ARRAY_SCRATCH_T* scratch,
+                                     const UNITY_UINT32 scratch_slots)
+{
+    UNITY_UNORDERED_ARRAY_T exp_side;
+    UNITY_UNORDERED_ARRAY_T act_side;
+
+    exp_side.array  = (UNITY_INTERNAL_PTR)expected;
+    exp_side.count  = expected_elements;
+    exp_side.length = 0;
+    act_side.array  = (UNITY_INTERNAL_PTR)actual;
+    act_side.count  = actual_elements;
+    act_side.length = 0;
+
+    UnityAssertUnordered(&exp_side, &act_side, msg, lineNumber, UNITY_DISPLAY_STYLE_UNKNOWN,
+                         scratch, scratch_slots);
+}
+
+/*-----------------------------------------------*/
+void UnityAssertIntArraySorted(UNITY_INTERNAL_PTR actual,
+                               const UNITY_UINT32 num_elements,
+                               const char* msg,
+                               const UNITY_LINE_TYPE lineNumber,
+                               const UNITY_DISPLAY_STYLE_T style)
+{
+    unsigned int length = style & 0xF;
+    UNITY_INT mask = 1;
+    UNITY_INT previous;
+    UNITY_INT current;
+    UNITY_UINT32 i;
+    int out_of_order;
+
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    if (num_elements == 0)
+    {
+        UnityPrintPointlessAndBail();
+    }
+
+    if (actual == NULL)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrNullPointerForActual);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    if ((length != 1) && (length != 2) && (length != 8))
+    {
+        length = 4;
+    }
+    if (length < (UNITY_INT_WIDTH / 8))
+    {
+        mask = (mask << 8 * length) - 1;
+    }
+    else
+    {
+        mask = -1;
+    }
+
+    previous = UnityReadIntElement(actual, 0, length);
+    for (i = 1; i < num_elements; i++)
+    {
+        current = UnityReadIntElement(actual, i, length);
+        if (style & UNITY_DISPLAY_RANGE_INT)
+        {
+            out_of_order = (current < previous);
+        }
+        else
+        {   /* UINT and HEX compare without sign extension */
+            out_of_order = (((UNITY_UINT)current & (UNITY_UINT)mask) < ((UNITY_UINT)previous & (UNITY_UINT)mask));
+        }
+
+        if (out_of_order)
+        {
+            if (!(style & UNITY_DISPLAY_RANGE_INT))
+            {
+                current &= mask;
+                previous &= mask;
+            }
+            UnityTestResultsFailBegin(lineNumber);
+            UnityPrint(UnityStrElement);
+            UnityPrintNumberUnsigned(i);
+            UnityPrint(UnityStrExpected);
+            UnityPrintNumberByStyle(current, style);
+            UnityPrint(UnityStrGt);
+            UnityPrint(UnityStrOrEqual);
+            UnityPrintNumberByStyle(previous, style);
+            UnityAddMsgIfSpecified(msg);
+            UNITY_FAIL_AND_BAIL;
+        }
+        previous = current;
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityAssertStringArraySorted(const char** actual,
+                                  const UNITY_UINT32 num_elements,
+                                  const char* msg,
+                                  const UNITY_LINE_TYPE lineNumber)
+{
+    const unsigned char* previous;
+    const unsigned char* current;
+    UNITY_UINT32 i;
+    UNITY_UINT32 c;
+
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    if (num_elements == 0)
+    {
+        UnityPrintPointlessAndBail();
+    }
+
+    if (actual == NULL)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrNullPointerForActual);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    for (i = 1; i < num_elements; i++)
+    {
+        previous = (const unsigned char*)actual[i - 1];
+        current  = (const unsigned char*)actual[i];
+
+        /* NULL sorts before every string */
+        if ((previous == NULL) || ((current != NULL) && (previous == current)))
+        {
+            continue;
+        }
+        if (current != NULL)
+        {
+            c = 0;
+            while ((previous[c] != '\0') && (previous[c] == current[c]))
+            {
+                c++;
+            }
+            if (previous[c] <= current[c])
+            {
+                continue;
+            }
+        }
+
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrElement);
+        UnityPrintNumberUnsigned(i);
+        UnityPrint(UnityStrExpected);
+        UnityPrintQuotedString(actual[i]);
+        UnityPrint(UnityStrGt);
+        UnityPrint(UnityStrOrEqual);
+        UnityPrintQuotedString(actual[i - 1]);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityAssertEqualMemory(UNITY_INTERNAL_PTR expected,
+                            UNITY_INTERNAL_PTR actual,
+                            const UNITY_UINT32 length,
+                            const UNITY_UINT32 num_elements,
+                            const char* msg,
+                            const UNITY_LINE_TYPE lineNumber,
+                            const UNITY_FLAGS_T flags)
+{
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_exp = (UNITY_PTR_ATTRIBUTE const unsigned char*)expected;
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_act = (UNITY_PTR_ATTRIBUTE const unsigned char*)actual;
+    UNITY_UINT32 elements = num_elements;
+    UNITY_UINT32 bytes;
+
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    if ((elements == 0) || (length == 0))
+    {
+        UnityPrintPointlessAndBail();
+    }
+
+    if (expected == actual)
+    {
+        return; /* Both are NULL or same pointer */
+    }
+
+    if (UnityIsOneArrayNull(expected, actual, lineNumber, msg))
+    {
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    while (elements--)
+    {
+        bytes = length;
+        while (bytes--)
+        {
+            if (*ptr_exp != *ptr_act)
+            {
+                UnityTestResultsFailBegin(lineNumber);
+                UnityPrint(UnityStrMemory);
+                if (num_elements > 1)
+                {
+                    UnityPrint(UnityStrElement);
+                    UnityPrintNumberUnsigned(num_elements - elements - 1);
+                }
+                UnityPrint(UnityStrByte);
                 UnityPrintNumberUnsigned(length - bytes - 1);
                 UnityPrint(UnityStrExpected);
                 UnityPrintNumberByStyle(*ptr_exp, UNITY_DISPLAY_STYLE_HEX8);
@@ -1661,143 +2629,1830 @@ void UnityAssertEqualMemory(UNITY_INTERNAL_PTR expected,
                 UnityAddMsgIfSpecified(msg);
                 UNITY_FAIL_AND_BAIL;
             }
-            ptr_exp++;
-            ptr_act++;
+            ptr_exp++;
+            ptr_act++;
+        }
+        if (flags == UNITY_ARRAY_TO_VAL)
+        {
+            ptr_exp = (UNITY_PTR_ATTRIBUTE const unsigned char*)expected;
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+#define UNITY_MASKED_COMPARE_BLOCK (64)
+
+/* Returns the offset of the first byte where (expected ^ actual) & mask is nonzero, or length.
+ * Differences are OR-ed together a block at a time with no branches in the inner loop, so
+ * compilers can vectorize it; only a block that differs is rescanned byte by byte. */
+static UNITY_UINT32 UnityFindMaskedDifference(UNITY_PTR_ATTRIBUTE const unsigned char* expected,
+                                              UNITY_PTR_ATTRIBUTE const unsigned char* actual,
+                                              UNITY_PTR_ATTRIBUTE const unsigned char* mask,
+                                              const UNITY_UINT32 length)
+{
+    UNITY_UINT32 start = 0;
+    UNITY_UINT32 end;
+    UNITY_UINT32 i;
+    unsigned char diff;
+
+    while (start < length)
+    {
+        end  = ((length - start) > UNITY_MASKED_COMPARE_BLOCK) ? (start + UNITY_MASKED_COMPARE_BLOCK) : length;
+        diff = 0;
+        for (i = start; i < end; i++)
+        {
+            diff = (unsigned char)(diff | ((expected[i] ^ actual[i]) & mask[i]));
+        }
+        if (diff != 0)
+        {
+            i = start; /* the block holds a difference, so this stops before end */
+            while (((expected[i] ^ actual[i]) & mask[i]) == 0)
+            {
+                i++;
+            }
+            return i;
+        }
+        start = end;
+    }
+    return length;
+}
+
+/*-----------------------------------------------*/
+static int UnityIsMaskNull(UNITY_INTERNAL_PTR mask, const UNITY_LINE_TYPE lineNumber, const char* msg)
+{
+    if (mask == NULL)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrNullPointerForMask);
+        UnityAddMsgIfSpecified(msg);
+        return 1;
+    }
+    return 0;
+}
+
+/*-----------------------------------------------*/
+void UnityAssertEqualMemoryMasked(UNITY_INTERNAL_PTR expected,
+                                  UNITY_INTERNAL_PTR actual,
+                                  UNITY_INTERNAL_PTR mask,
+                                  const UNITY_UINT32 length,
+                                  const char* msg,
+                                  const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_exp = (UNITY_PTR_ATTRIBUTE const unsigned char*)expected;
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_act = (UNITY_PTR_ATTRIBUTE const unsigned char*)actual;
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_mask = (UNITY_PTR_ATTRIBUTE const unsigned char*)mask;
+    UNITY_UINT32 offset;
+
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    if (length == 0)
+    {
+        UnityPrintPointlessAndBail();
+    }
+
+    if (expected == actual)
+    {
+        return; /* Both are NULL or same pointer */
+    }
+
+    if (UnityIsOneArrayNull(expected, actual, lineNumber, msg) || UnityIsMaskNull(mask, lineNumber, msg))
+    {
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    offset = UnityFindMaskedDifference(ptr_exp, ptr_act, ptr_mask, length);
+    if (offset < length)
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrMemory);
+        UnityPrint(UnityStrByte);
+        UnityPrintNumberUnsigned(offset);
+        UnityPrint(UnityStrExpected);
+        UnityPrintMaskBits(ptr_mask[offset], ptr_exp[offset], 8);
+        UnityPrint(UnityStrWas);
+        UnityPrintMaskBits(ptr_mask[offset], ptr_act[offset], 8);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+}
+
+/*-----------------------------------------------*/
+static UNITY_UINT UnityReadUnsignedElement(UNITY_INTERNAL_PTR array, const UNITY_UINT32 index, const unsigned int length)
+{
+    switch (length)
+    {
+        case 1:  return ((UNITY_PTR_ATTRIBUTE const UNITY_UINT8*)array)[index];
+        case 2:  return ((UNITY_PTR_ATTRIBUTE const UNITY_UINT16*)array)[index];
+#ifdef UNITY_SUPPORT_64
+        case 8:  return ((UNITY_PTR_ATTRIBUTE const UNITY_UINT64*)array)[index];
+#endif
+        default: return ((UNITY_PTR_ATTRIBUTE const UNITY_UINT32*)array)[index];
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityAssertBitsArray(UNITY_INTERNAL_PTR mask,
+                          UNITY_INTERNAL_PTR expected,
+                          UNITY_INTERNAL_PTR actual,
+                          const UNITY_UINT32 num_elements,
+                          const char* msg,
+                          const UNITY_LINE_TYPE lineNumber,
+                          const UNITY_DISPLAY_STYLE_T style)
+{
+    unsigned int length = style & 0xF;
+    UNITY_UINT32 offset;
+    UNITY_UINT32 element;
+    UNITY_UINT element_mask;
+
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    if ((length != 1) && (length != 2) && (length != 8))
+    {
+        length = 4;
+    }
+
+    if (num_elements == 0)
+    {
+        UnityPrintPointlessAndBail();
+    }
+
+    if (expected == actual)
+    {
+        return; /* Both are NULL or same pointer */
+    }
+
+    if (UnityIsOneArrayNull(expected, actual, lineNumber, msg) || UnityIsMaskNull(mask, lineNumber, msg))
+    {
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    /* Masks line up byte for byte with the elements they cover, whatever the endianness */
+    offset = UnityFindMaskedDifference((UNITY_PTR_ATTRIBUTE const unsigned char*)expected,
+                                       (UNITY_PTR_ATTRIBUTE const unsigned char*)actual,
+                                       (UNITY_PTR_ATTRIBUTE const unsigned char*)mask,
+                                       num_elements * length);
+    if (offset < (num_elements * length))
+    {
+        element = offset / length;
+        element_mask = UnityReadUnsignedElement(mask, element, length);
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrElement);
+        UnityPrintNumberUnsigned(element);
+        UnityPrint(UnityStrExpected);
+        UnityPrintMaskBits(element_mask, UnityReadUnsignedElement(expected, element, length), (UNITY_INT32)(length * 8));
+        UnityPrint(UnityStrWas);
+        UnityPrintMaskBits(element_mask, UnityReadUnsignedElement(actual, element, length), (UNITY_INT32)(length * 8));
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+}
+
+/*-----------------------------------------------*/
+#ifdef UNITY_SUPPORT_64
+/* XXH64 with a seed of 0, so expected values can be produced with `xxhsum -H1` */
+#define UNITY_HASH_PRIME(hi, lo) (((UNITY_UINT64)(hi) << 32) | (UNITY_UINT64)(lo))
+#define UNITY_HASH_PRIME1 UNITY_HASH_PRIME(0x9E3779B1UL, 0x85EBCA87UL)
+#define UNITY_HASH_PRIME2 UNITY_HASH_PRIME(0xC2B2AE3DUL, 0x27D4EB4FUL)
+#define UNITY_HASH_PRIME3 UNITY_HASH_PRIME(0x165667B1UL, 0x9E3779F9UL)
+#define UNITY_HASH_PRIME4 UNITY_HASH_PRIME(0x85EBCA77UL, 0xC2B2AE63UL)
+#define UNITY_HASH_PRIME5 UNITY_HASH_PRIME(0x27D4EB2FUL, 0x165667C5UL)
+#define UNITY_HASH_ROTL(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+static UNITY_UINT64 UnityHashRead64(UNITY_PTR_ATTRIBUTE const unsigned char* p)
+{
+    /* Little-endian and alignment-agnostic; compilers fold this into a single load */
+    return  (UNITY_UINT64)p[0]        | ((UNITY_UINT64)p[1] << 8)  |
+           ((UNITY_UINT64)p[2] << 16) | ((UNITY_UINT64)p[3] << 24) |
+           ((UNITY_UINT64)p[4] << 32) | ((UNITY_UINT64)p[5] << 40) |
+           ((UNITY_UINT64)p[6] << 48) | ((UNITY_UINT64)p[7] << 56);
+}
+
+static UNITY_UINT64 UnityHashRead32(UNITY_PTR_ATTRIBUTE const unsigned char* p)
+{
+    return  (UNITY_UINT64)p[0]        | ((UNITY_UINT64)p[1] << 8)  |
+           ((UNITY_UINT64)p[2] << 16) | ((UNITY_UINT64)p[3] << 24);
+}
+
+static UNITY_UINT64 UnityHashRound(UNITY_UINT64 lane, const UNITY_UINT64 input)
+{
+    lane += input * UNITY_HASH_PRIME2;
+    lane  = UNITY_HASH_ROTL(lane, 31);
+    return lane * UNITY_HASH_PRIME1;
+}
+
+static UNITY_UINT64 UnityHashMergeRound(UNITY_UINT64 hash, const UNITY_UINT64 lane)
+{
+    hash ^= UnityHashRound(0, lane);
+    return (hash * UNITY_HASH_PRIME1) + UNITY_HASH_PRIME4;
+}
+
+static void UnityHashStripe(UNITY_UINT64* lanes, UNITY_PTR_ATTRIBUTE const unsigned char* p)
+{
+    lanes[0] = UnityHashRound(lanes[0], UnityHashRead64(p));
+    lanes[1] = UnityHashRound(lanes[1], UnityHashRead64(p + 8));
+    lanes[2] = UnityHashRound(lanes[2], UnityHashRead64(p + 16));
+    lanes[3] = UnityHashRound(lanes[3], UnityHashRead64(p + 24));
+}
+
+/*-----------------------------------------------*/
+void UnityHash_Init(UNITY_HASH_T* state)
+{
+    state->TotalLength   = 0;
+    state->Lanes[0]      = UNITY_HASH_PRIME1 + UNITY_HASH_PRIME2;
+    state->Lanes[1]      = UNITY_HASH_PRIME2;
+    state->Lanes[2]      = 0;
+    state->Lanes[3]      = 0 - UNITY_HASH_PRIME1;
+    state->PendingLength = 0;
+}
+
+/*-----------------------------------------------*/
+void UnityHash_Update(UNITY_HASH_T* state, UNITY_INTERNAL_PTR data, const UNITY_UINT length)
+{
+    UNITY_PTR_ATTRIBUTE const unsigned char* p = (UNITY_PTR_ATTRIBUTE const unsigned char*)data;
+    UNITY_UINT remaining = length;
+
+    if ((p == NULL) || (remaining == 0))
+    {
+        return;
+    }
+
+    state->TotalLength += remaining;
+
+    /* Top up a partial stripe left over from the previous chunk first */
+    if (state->PendingLength > 0)
+    {
+        while ((state->PendingLength < sizeof(state->Pending)) && (remaining > 0))
+        {
+            state->Pending[state->PendingLength++] = *p++;
+            remaining--;
+        }
+        if (state->PendingLength < sizeof(state->Pending))
+        {
+            return;
+        }
+        UnityHashStripe(state->Lanes, state->Pending);
+        state->PendingLength = 0;
+    }
+
+    while (remaining >= sizeof(state->Pending))
+    {
+        UnityHashStripe(state->Lanes, p);
+        p += sizeof(state->Pending);
+        remaining -= sizeof(state->Pending);
+    }
+
+    while (remaining > 0)
+    {
+        state->Pending[state->PendingLength++] = *p++;
+        remaining--;
+    }
+}
+
+/*-----------------------------------------------*/
+UNITY_UINT64 UnityHash_Final(const UNITY_HASH_T* state)
+{
+    UNITY_PTR_ATTRIBUTE const unsigned char* p = state->Pending;
+    UNITY_UINT32 remaining = state->PendingLength;
+    UNITY_UINT64 hash;
+
+    if (state->TotalLength >= sizeof(state->Pending))
+    {
+        hash = UNITY_HASH_ROTL(state->Lanes[0], 1)  + UNITY_HASH_ROTL(state->Lanes[1], 7) +
+               UNITY_HASH_ROTL(state->Lanes[2], 12) + UNITY_HASH_ROTL(state->Lanes[3], 18);
+        hash = UnityHashMergeRound(hash, state->Lanes[0]);
+        hash = UnityHashMergeRound(hash, state->Lanes[1]);
+        hash = UnityHashMergeRound(hash, state->Lanes[2]);
+        hash = UnityHashMergeRound(hash, state->Lanes[3]);
+    }
+    else
+    {
+        hash = state->Lanes[2] + UNITY_HASH_PRIME5;
+    }
+    hash += state->TotalLength;
+
+    while (remaining >= 8)
+    {
+        hash ^= UnityHashRound(0, UnityHashRead64(p));
+        hash  = (UNITY_HASH_ROTL(hash, 27) * UNITY_HASH_PRIME1) + UNITY_HASH_PRIME4;
+        p += 8;
+        remaining -= 8;
+    }
+    if (remaining >= 4)
+    {
+        hash ^= UnityHashRead32(p) * UNITY_HASH_PRIME1;
+        hash  = (UNITY_HASH_ROTL(hash, 23) * UNITY_HASH_PRIME2) + UNITY_HASH_PRIME3;
+        p += 4;
+        remaining -= 4;
+    }
+    while (remaining > 0)
+    {
+        hash ^= (UNITY_UINT64)(*p++) * UNITY_HASH_PRIME5;
+        hash  = UNITY_HASH_ROTL(hash, 11) * UNITY_HASH_PRIME1;
+        remaining--;
+    }
+
+    hash ^= hash >> 33;
+    hash *= UNITY_HASH_PRIME2;
+    hash ^= hash >> 29;
+    hash *= UNITY_HASH_PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/*-----------------------------------------------*/
+UNITY_UINT64 UnityHash(UNITY_INTERNAL_PTR data, const UNITY_UINT length)
+{
+    UNITY_HASH_T state;
+
+    UnityHash_Init(&state);
+    UnityHash_Update(&state, data, length);
+    return UnityHash_Final(&state);
+}
+
+/*-----------------------------------------------*/
+void UnityAssertEqualHash(const UNITY_UINT64 expected,
+                          const UNITY_UINT64 actual,
+                          const char* msg,
+                          const UNITY_LINE_TYPE lineNumber)
+{
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    if (expected != actual)
+    {
+        /* Print the actual hash in full so the expectation can be refreshed */
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrHash);
+        UnityPrint(UnityStrExpected);
+        UnityPrintNumberByStyle((UNITY_INT)expected, UNITY_DISPLAY_STYLE_HEX64);
+        UnityPrint(UnityStrWas);
+        UnityPrintNumberByStyle((UNITY_INT)actual, UNITY_DISPLAY_STYLE_HEX64);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityAssertMemoryHash(const UNITY_UINT64 expected,
+                           UNITY_INTERNAL_PTR actual,
+                           const UNITY_UINT length,
+                           const char* msg,
+                           const UNITY_LINE_TYPE lineNumber)
+{
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    if ((actual == NULL) && (length > 0))
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrNullPointerForActual);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    UnityAssertEqualHash(expected, UnityHash(actual, length), msg, lineNumber);
+}
+#endif /* UNITY_SUPPORT_64 */
+
+/*-----------------------------------------------
+ * Golden File Assertions
+ *-----------------------------------------------*/
+
+#ifdef UNITY_INCLUDE_GOLDEN_FILE
+int UnityGoldenFileUpdate = 0;
+
+static int UnityGoldenFileUpdateRequested(void)
+{
+    const char* env;
+
+    if (UnityGoldenFileUpdate)
+    {
+        return 1;
+    }
+
+    env = getenv("UNITY_UPDATE_GOLDEN");
+    return (env != NULL) && (env[0] != '\0') && !((env[0] == '0') && (env[1] == '\0'));
+}
+
+/*-----------------------------------------------*/
+/* Streams the golden file through a small buffer and compares it against actual.
+ * Returns 1 on an exact match. Otherwise fills in the first differing offset, the
+ * total file length and, when both sides have a byte at that offset, the golden byte. */
+static int UnityGoldenFileCompare(FILE* file,
+                                  UNITY_PTR_ATTRIBUTE const unsigned char* actual,
+                                  const UNITY_UINT length,
+                                  UNITY_UINT* offset,
+                                  UNITY_UINT* file_length,
+                                  int* golden_byte)
+{
+    unsigned char chunk[UNITY_GOLDEN_FILE_BUFFER_SIZE];
+    UNITY_UINT position = 0;
+    size_t got;
+    size_t i;
+    int matched = 1;
+
+    *golden_byte = -1;
+    while ((got = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    {
+        /* whole chunks are compared at once; only a chunk that differs is searched for its first difference */
+        if (matched)
+        {
+            size_t same = ((UNITY_UINT)got > (length - position)) ? (size_t)(length - position) : got;
+
+            if ((same > 0) && (memcmp(chunk, (const void*)&actual[position], same) != 0))
+            {
+                for (i = 0; chunk[i] == actual[position + i]; i++)
+                {
+                }
+                matched = 0;
+                *offset = position + i;
+                *golden_byte = chunk[i];
+            }
+            else if (same < got)
+            {
+                matched = 0;
+                *offset = position + same;
+            }
+        }
+        position += (UNITY_UINT)got;
+    }
+
+    *file_length = position;
+    if (matched && (position != length))
+    {
+        matched = 0;
+        *offset = position;
+    }
+    return matched;
+}
+
+/*-----------------------------------------------*/
+/* Writes to "<path>.tmp" first and renames it over the golden file, so an
+ * interrupted update never leaves a truncated golden file behind. Returns the
+ * failure to report, or NULL once the golden file holds the new contents. */
+static const char* UnityGoldenFileWrite(const char* path,
+                                        UNITY_PTR_ATTRIBUTE const unsigned char* actual,
+                                        const UNITY_UINT length)
+{
+    static const char suffix[] = ".tmp";
+    char temp_path[UNITY_GOLDEN_FILE_PATH_MAX];
+    FILE* file;
+    size_t n = 0;
+    size_t i;
+    int ok;
+
+    while (path[n] != '\0')
+    {
+        if ((n + sizeof(suffix)) >= sizeof(temp_path))
+        {
+            return UnityStrGoldenWrite;
+        }
+        temp_path[n] = path[n];
+        n++;
+    }
+    for (i = 0; i < sizeof(suffix); i++)
+    {
+        temp_path[n + i] = suffix[i];
+    }
+
+    file = fopen(temp_path, "wb");
+    if (file == NULL)
+    {
+        return UnityStrGoldenWrite;
+    }
+    ok = (length == 0) || (fwrite(actual, 1, (size_t)length, file) == (size_t)length);
+    ok = (fclose(file) == 0) && ok;
+    if (!ok)
+    {
+        (void)remove(temp_path);
+        return UnityStrGoldenWrite;
+    }
+
+    /* Never remove the old golden file to make way: if the rename fails, both
+     * it and the complete update stay for someone to sort out by hand */
+    if (rename(temp_path, path) != 0)
+    {
+        return UnityStrGoldenReplace;
+    }
+    return NULL;
+}
+
+/*-----------------------------------------------*/
+void UnityAssertMatchesGoldenFile(const char* path,
+                                  UNITY_INTERNAL_PTR actual,
+                                  const UNITY_UINT length,
+                                  const char* msg,
+                                  const UNITY_LINE_TYPE lineNumber)
+{
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_act = (UNITY_PTR_ATTRIBUTE const unsigned char*)actual;
+    UNITY_UINT offset = 0;
+    UNITY_UINT file_length = 0;
+    int golden_byte = -1;
+    int matched = 0;
+    FILE* file;
+
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    if ((actual == NULL) && (length > 0))
+    {
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(UnityStrNullPointerForActual);
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    file = fopen(path, "rb");
+    if (file != NULL)
+    {
+        matched = UnityGoldenFileCompare(file, ptr_act, length, &offset, &file_length, &golden_byte);
+        (void)fclose(file);
+    }
+
+    if (matched)
+    {
+        return;
+    }
+
+    if (UnityGoldenFileUpdateRequested())
+    {
+        const char* failure = UnityGoldenFileWrite(path, ptr_act, length);
+        if (failure == NULL)
+        {
+            return;
+        }
+        UnityTestResultsFailBegin(lineNumber);
+        UnityPrint(failure);
+        UnityPrint(path);
+        if (failure == UnityStrGoldenReplace)
+        {
+            UnityPrint(UnityStrGoldenLeftIn);
+            UnityPrint(path);
+            UnityPrint(".tmp");
+        }
+        UnityAddMsgIfSpecified(msg);
+        UNITY_FAIL_AND_BAIL;
+    }
+
+    UnityTestResultsFailBegin(lineNumber);
+    if (file == NULL)
+    {
+        UnityPrint(UnityStrGoldenOpen);
+        UnityPrint(path);
+    }
+    else
+    {
+        UnityPrint(UnityStrGolden);
+        UnityPrint(path);
+        UNITY_OUTPUT_CHAR('.');
+        UnityPrint(UnityStrByte);
+        UnityPrintNumberUnsigned(offset);
+        if ((golden_byte >= 0) && (offset < length))
+        {
+            UnityPrint(UnityStrExpected);
+            UnityPrintNumberByStyle(golden_byte, UNITY_DISPLAY_STYLE_HEX8);
+            UnityPrint(UnityStrWas);
+            UnityPrintNumberByStyle(ptr_act[offset], UNITY_DISPLAY_STYLE_HEX8);
+        }
+        if (file_length != length)
+        {
+            UnityPrint(UnityStrExpected);
+            UnityPrint(UnityStrLength);
+            UnityPrintNumberUnsigned(file_length);
+            UnityPrint(UnityStrWas);
+            UnityPrintNumberUnsigned(length);
+        }
+    }
+    UnityAddMsgIfSpecified(msg);
+    UNITY_FAIL_AND_BAIL;
+}
+#endif /* UNITY_INCLUDE_GOLDEN_FILE */
+
+/*-----------------------------------------------*/
+
+static union
+{
+    UNITY_INT8 i8;
+    UNITY_INT16 i16;
+    UNITY_INT32 i32;
+#ifdef UNITY_SUPPORT_64
+    UNITY_INT64 i64;
+#endif
+#ifndef UNITY_EXCLUDE_FLOAT
+    float f;
+#endif
+#ifndef UNITY_EXCLUDE_DOUBLE
+    double d;
+#endif
+} UnityQuickCompare;
+
+UNITY_INTERNAL_PTR UnityNumToPtr(const UNITY_INT num, const UNITY_UINT8 size)
+{
+    switch(size)
+    {
+        case 1:
+            UnityQuickCompare.i8 = (UNITY_INT8)num;
+            return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.i8);
+
+        case 2:
+            UnityQuickCompare.i16 = (UNITY_INT16)num;
+            return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.i16);
+
+#ifdef UNITY_SUPPORT_64
+        case 8:
+            UnityQuickCompare.i64 = (UNITY_INT64)num;
+            return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.i64);
+#endif
+
+        default: /* 4 bytes */
+            UnityQuickCompare.i32 = (UNITY_INT32)num;
+            return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.i32);
+    }
+}
+
+#ifndef UNITY_EXCLUDE_FLOAT
+/*-----------------------------------------------*/
+UNITY_INTERNAL_PTR UnityFloatToPtr(const float num)
+{
+    UnityQuickCompare.f = num;
+    return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.f);
+}
+#endif
+
+#ifndef UNITY_EXCLUDE_DOUBLE
+/*-----------------------------------------------*/
+UNITY_INTERNAL_PTR UnityDoubleToPtr(const double num)
+{
+    UnityQuickCompare.d = num;
+    return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.d);
+}
+#endif
+
+/*-----------------------------------------------
+ * Control Functions
+ *-----------------------------------------------*/
+
+/*-----------------------------------------------*/
+void UnityFail(const char* msg, const UNITY_LINE_TYPE line)
+{
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    UnityTestResultsBegin(Unity.TestFile, line);
+    UnityPrint(UnityStrFail);
+    if (msg != NULL)
+    {
+        UNITY_OUTPUT_CHAR(':');
+
+#ifndef UNITY_EXCLUDE_DETAILS
+        if (Unity.CurrentDetail1)
+        {
+            UnityPrint(UnityStrDetail1Name);
+            UnityPrint(Unity.CurrentDetail1);
+            if (Unity.CurrentDetail2)
+            {
+                UnityPrint(UnityStrDetail2Name);
+                UnityPrint(Unity.CurrentDetail2);
+            }
+            UnityPrint(UnityStrSpacer);
+        }
+#endif
+        if (msg[0] != ' ')
+        {
+            UNITY_OUTPUT_CHAR(' ');
+        }
+        UnityPrint(msg);
+    }
+
+    UNITY_FAIL_AND_BAIL;
+}
+
+/*-----------------------------------------------*/
+void UnityIgnore(const char* msg, const UNITY_LINE_TYPE line)
+{
+    RETURN_IF_FAIL_OR_IGNORE;
+
+    UnityTestResultsBegin(Unity.TestFile, line);
+    UnityPrint(UnityStrIgnore);
+    if (msg != NULL)
+    {
+        UNITY_OUTPUT_CHAR(':');
+        UNITY_OUTPUT_CHAR(' ');
+        UnityPrint(msg);
+    }
+    UNITY_IGNORE_AND_BAIL;
+}
+
+/*-----------------------------------------------*/
+/* Called by runners instead of running a test whose prerequisite failed. The
+ * test is reported as ignored, naming the prerequisite. */
+void UnitySkipDependentTest(const char* prerequisite)
+{
+    UnityTestResultsBegin(Unity.TestFile, Unity.CurrentTestLineNumber);
+    UnityPrint(UnityStrIgnore);
+    UNITY_OUTPUT_CHAR(':');
+    UNITY_OUTPUT_CHAR(' ');
+    UnityPrint(UnityStrSkippedBecause);
+    UnityPrint(prerequisite);
+    UnityPrint(UnityStrSkippedFailed);
+    Unity.CurrentTestIgnored = 1;
+}
+
+/*-----------------------------------------------*/
+/* Called by runners for each case of a test with a TEST_CASE_SOURCE, so cases
+ * are made one at a time rather than all up front. Returns the name to run
+ * the case under, as test(case), or NULL once source has no case at index. */
+const char* UnityTestCaseNext(UnityTestCaseSource source, UNITY_TEST_CASE_T* test_case, const char* test, UNITY_UINT32 index)
+{
+    static char name[UNITY_TEST_NAME_LENGTH];
+    char number[11];
+    const char* case_name = test_case->Name;
+    UNITY_UINT32 digits = (UNITY_UINT32)sizeof(number) - 1;
+    UNITY_UINT32 n = 0;
+
+    test_case->Index = index;
+    test_case->Data = NULL;
+    test_case->Name[0] = '\0';
+    if (!source(test_case))
+    {
+        return NULL;
+    }
+    test_case->Name[sizeof(test_case->Name) - 1] = '\0';
+
+    if (case_name[0] == '\0')
+    {
+        number[digits] = '\0';
+        do
+        {
+            number[--digits] = (char)('0' + (index % 10));
+            index /= 10;
+        } while (index > 0);
+        case_name = &number[digits];
+    }
+
+    /* a name too long for the buffer loses the end of the case name, but keeps its closing parenthesis */
+    while ((*test != '\0') && (n < sizeof(name) - 3))
+    {
+        name[n++] = *test++;
+    }
+    name[n++] = '(';
+    while ((*case_name != '\0') && (n < sizeof(name) - 2))
+    {
+        name[n++] = *case_name++;
+    }
+    name[n++] = ')';
+    name[n] = '\0';
+    return name;
+}
+
+/*-----------------------------------------------*/
+void UnityMessage(const char* msg, const UNITY_LINE_TYPE line)
+{
+    UnityTestResultsBegin(Unity.TestFile, line);
+    UnityPrint("INFO");
+    if (msg != NULL)
+    {
+      UNITY_OUTPUT_CHAR(':');
+      UNITY_OUTPUT_CHAR(' ');
+      UnityPrint(msg);
+    }
+    UNITY_PRINT_EOL();
+}
+
+/*-----------------------------------------------
+ * State Snapshots
+ *-----------------------------------------------*/
+#ifdef UNITY_INCLUDE_STATE_SNAPSHOT
+
+/* Registered regions, each with its copy at Offset in the snapshot buffer */
+typedef struct
+{
+    unsigned char* Start;
+    size_t Bytes;
+    size_t Offset;
+} UNITY_SNAPSHOT_REGION_T;
+
+static UNITY_SNAPSHOT_REGION_T UnitySnapshotRegions[UNITY_SNAPSHOT_REGIONS];
+static UNITY_UINT32 UnitySnapshotCount;
+static size_t UnitySnapshotUsed;
+static unsigned char UnitySnapshotBuffer[UNITY_SNAPSHOT_BYTES];
+
+/*-----------------------------------------------*/
+int UnitySnapshotRegion(void* start, size_t bytes)
+{
+    UNITY_SNAPSHOT_REGION_T* region = NULL;
+    UNITY_UINT32 i;
+
+    /* A suite set up again in the same process takes a fresh copy of the same region */
+    for (i = 0; i < UnitySnapshotCount; i++)
+    {
+        if ((UnitySnapshotRegions[i].Start == (unsigned char*)start) && (UnitySnapshotRegions[i].Bytes == bytes))
+        {
+            region = &UnitySnapshotRegions[i];
+        }
+    }
+    if (region == NULL)
+    {
+        if ((UnitySnapshotCount == UNITY_SNAPSHOT_REGIONS) || (bytes > (UNITY_SNAPSHOT_BYTES - UnitySnapshotUsed)))
+        {
+            UnityPrint("ERROR: State Snapshots Need More Than UNITY_SNAPSHOT_BYTES Or UNITY_SNAPSHOT_REGIONS");
+            UNITY_PRINT_EOL();
+            return 1;
+        }
+        region = &UnitySnapshotRegions[UnitySnapshotCount++];
+        region->Start = (unsigned char*)start;
+        region->Bytes = bytes;
+        region->Offset = UnitySnapshotUsed;
+        UnitySnapshotUsed += bytes;
+    }
+    memcpy(&UnitySnapshotBuffer[region->Offset], region->Start, bytes);
+    return 0;
+}
+
+/*-----------------------------------------------*/
+void UnitySnapshotRestore(void)
+{
+    UNITY_UINT32 i;
+
+    for (i = 0; i < UnitySnapshotCount; i++)
+    {
+        memcpy(UnitySnapshotRegions[i].Start, &UnitySnapshotBuffer[UnitySnapshotRegions[i].Offset], UnitySnapshotRegions[i].Bytes);
+    }
+}
+
+/*-----------------------------------------------*/
+void UnitySnapshotClear(void)
+{
+    UnitySnapshotCount = 0;
+    UnitySnapshotUsed = 0;
+}
+
+#endif /* UNITY_INCLUDE_STATE_SNAPSHOT */
+
+/*-----------------------------------------------
+ * Test Name Sets
+ *-----------------------------------------------*/
+#ifdef UNITY_INCLUDE_NAME_SET
+
+/* Exact test names read from files, each stored as a byte of UNITY_NAME_* flags
+ * followed by the name. Slots hold the name's offset plus one, so zero marks an
+ * empty slot. */
+#define UNITY_NAME_INCLUDE ((char)0x01)
+#define UNITY_NAME_EXCLUDE ((char)0x02)
+#define UNITY_NAME_RERUN   ((char)0x04)
+#define UNITY_NAME_PASSED  ((char)0x08)
+#define UNITY_NAME_TIMED   ((char)0x10)
+#define UNITY_NAME_MINE    ((char)0x20)
+#define UNITY_NAME_RAN     ((char)0x40)
+
+static char UnityNameText[UNITY_FILTER_FILE_TEXT_SIZE];
+static UNITY_UINT32 UnityNameTextUsed;
+static UNITY_UINT32 UnityNameSlots[UNITY_FILTER_FILE_SLOTS];
+
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+/*-----------------------------------------------*/
+static void UnityNameSetClear(void)
+{
+    UNITY_UINT32 i;
+
+    UnityNameTextUsed = 0;
+    for (i = 0; i < UNITY_FILTER_FILE_SLOTS; i++)
+    {
+        UnityNameSlots[i] = 0;
+    }
+}
+#endif
+
+/*-----------------------------------------------*/
+static UNITY_UINT32 UnityNameHash(const char* name, UNITY_UINT32 length)
+{
+    UNITY_UINT32 hash = 2166136261u; /* FNV-1a */
+    UNITY_UINT32 i;
+
+    for (i = 0; i < length; i++)
+    {
+        hash = (hash ^ (UNITY_UINT32)(unsigned char)name[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/*-----------------------------------------------*/
+/* Returns the slot holding this name, or the empty slot where it belongs. */
+static UNITY_UINT32* UnityNameSetFind(const char* name, UNITY_UINT32 length)
+{
+    UNITY_UINT32 slot = UnityNameHash(name, length) & (UNITY_FILTER_FILE_SLOTS - 1);
+    UNITY_UINT32 probes;
+
+    for (probes = 0; probes < UNITY_FILTER_FILE_SLOTS; probes++)
+    {
+        const char* stored;
+        UNITY_UINT32 i = 0;
+
+        if (UnityNameSlots[slot] == 0)
+        {
+            return &UnityNameSlots[slot];
+        }
+
+        stored = &UnityNameText[UnityNameSlots[slot]]; /* skips the flags */
+        while ((i < length) && (stored[i] == name[i]))
+        {
+            i++;
+        }
+        if ((i == length) && (stored[i] == '\0'))
+        {
+            return &UnityNameSlots[slot];
+        }
+        slot = (slot + 1) & (UNITY_FILTER_FILE_SLOTS - 1);
+    }
+    return NULL;
+}
+
+/*-----------------------------------------------*/
+/* Adds the name if it is new and returns its flags, or NULL if it is full. */
+static char* UnityNameSetInsert(const char* name, UNITY_UINT32 length)
+{
+    UNITY_UINT32* slot = UnityNameSetFind(name, length);
+    UNITY_UINT32 i;
+
+    if ((slot != NULL) && (*slot == 0) &&
+        ((UnityNameTextUsed + length + 2) <= UNITY_FILTER_FILE_TEXT_SIZE))
+    {
+        UnityNameText[UnityNameTextUsed++] = 0;
+        *slot = UnityNameTextUsed;
+        for (i = 0; i < length; i++)
+        {
+            UnityNameText[UnityNameTextUsed++] = name[i];
+        }
+        UnityNameText[UnityNameTextUsed++] = '\0';
+    }
+
+    return ((slot == NULL) || (*slot == 0)) ? NULL : &UnityNameText[*slot - 1];
+}
+
+/*-----------------------------------------------*/
+/* Adds the name if it is new and returns its flags for the caller to update. */
+static char* UnityNameSetAdd(const char* name, UNITY_UINT32 length)
+{
+    char* flags = UnityNameSetInsert(name, length);
+
+    if (flags == NULL)
+    {
+        UnityPrint("ERROR: Too Many Test Names In Filter Files");
+        UNITY_PRINT_EOL();
+    }
+    return flags;
+}
+
+/*-----------------------------------------------*/
+static char UnityNameSetFlags(const char* name)
+{
+    const UNITY_UINT32* slot;
+    UNITY_UINT32 length = 0;
+
+    if ((UnityNameTextUsed == 0) || (name == NULL))
+    {
+        return 0;
+    }
+    while (name[length] != '\0')
+    {
+        length++;
+    }
+    slot = UnityNameSetFind(name, length);
+    return ((slot != NULL) && (*slot != 0)) ? UnityNameText[*slot - 1] : (char)0;
+}
+
+#endif /* UNITY_INCLUDE_NAME_SET */
+
+/*-----------------------------------------------
+ * Last Run State
+ *-----------------------------------------------*/
+#ifdef UNITY_INCLUDE_RUN_STATE
+
+/* The state file has one line per test: its name, a tab, its status and a tab,
+ * then its duration in milliseconds. The name is written and flushed before the
+ * test starts, so a test that crashes the runner is left without a status. A
+ * last line of a tab and END marks a run that finished.
+ *
+ * A run writes "<path>.tmp" and only renames it over the state file at its end,
+ * once the entries of the tests it did not run have been copied over. So a run
+ * of a few tests keeps what is known of the rest. A "<path>.tmp" still there
+ * when the next run starts is what a crashed run left, and is merged then. */
+static char UnityRunStatePath[UNITY_FILTER_FILE_LINE_MAX];
+static char UnityRunStateTempPath[UNITY_FILTER_FILE_LINE_MAX];
+static FILE* UnityRunStateFile = NULL;
+static int UnityRunStateUnmarked = 0;
+static int UnityRunStateRerun = 0;
+static int UnityRunStatePass = 0;
+static int UnityRunStateLastPass = 0;
+static int UnityRunStateInOrder = 0;
+static int UnityRunStateComplete = 0;
+static UNITY_UINT32 UnityNameTimes[UNITY_FILTER_FILE_SLOTS];
+
+/* A time budget is in milliseconds, 0 when there is none */
+static UNITY_UINT32 UnityTimeBudget = 0;
+static UNITY_UINT32 UnityTimeSpent = 0;
+
+/*-----------------------------------------------*/
+/* Reads a state file to learn how long each test took and, unless it is a
+ * timing history, which tests failed. Returns 1 once it is read, 0 on an error
+ * it has reported, or -1 if there is no such file. */
+static int UnityRunStateRead(const char* path, int history)
+{
+    char line[UNITY_FILTER_FILE_LINE_MAX];
+    FILE* file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        return -1;
+    }
+
+    while (fgets(line, (int)sizeof(line), file) != NULL)
+    {
+        UNITY_UINT32 length = 0;
+        char* flags;
+        const char* status;
+        const char* time;
+
+        while ((line[length] != '\0') && (line[length] != '\t') && (line[length] != '\n'))
+        {
+            length++;
+        }
+        if (length == 0)
+        {
+            if (!history)
+            {
+                UnityRunStateComplete = (line[0] == '\t') && (line[1] == 'E');
+            }
+            continue;
         }
-        if (flags == UNITY_ARRAY_TO_VAL)
+        status = (line[length] == '\t') ? &line[length + 1] : "";
+
+        flags = UnityNameSetAdd(line, length);
+        if (flags == NULL)
+        {
+            fclose(file);
+            return 0;
+        }
+        time = status;
+        while ((*time != '\0') && (*time != '\t'))
+        {
+            time++;
+        }
+        if (*time++ == '\t') /* a test that never finished has no time */
+        {
+            UNITY_UINT32 ms = 0;
+
+            while ((*time >= '0') && (*time <= '9'))
+            {
+                ms = (ms * 10) + (UNITY_UINT32)(*time++ - '0');
+            }
+            UnityNameTimes[UnityNameSetFind(line, length) - UnityNameSlots] = ms;
+            if (history)
+            {
+                *flags = (char)(*flags | UNITY_NAME_TIMED);
+            }
+        }
+
+        if (history)
+        {
+            continue;
+        }
+        if ((*status == 'P') || (*status == 'I'))
+        {
+            *flags = (char)((*flags & ~UNITY_NAME_RERUN) | UNITY_NAME_PASSED);
+        }
+        else /* failed, skipped, or never finished */
+        {
+            *flags = (char)((*flags & ~UNITY_NAME_PASSED) | UNITY_NAME_RERUN);
+        }
+    }
+
+    fclose(file);
+    return 1;
+}
+
+/*-----------------------------------------------*/
+/* Runners with tests that depend on others call this before parsing the
+ * options. --fail-first and --time-budget then leave the tests in the order
+ * they are run in, so each still follows its prerequisites. */
+void UnityRunStateKeepOrder(void)
+{
+    UnityRunStateInOrder = 1;
+}
+
+/*-----------------------------------------------*/
+static UNITY_UINT32 UnityRunStateTime(const char* name)
+{
+    const UNITY_UINT32* slot;
+    UNITY_UINT32 length = 0;
+
+    if ((UnityNameTextUsed == 0) || (name == NULL))
+    {
+        return 0;
+    }
+    while (name[length] != '\0')
+    {
+        length++;
+    }
+    slot = UnityNameSetFind(name, length);
+    return ((slot != NULL) && (*slot != 0)) ? UnityNameTimes[slot - UnityNameSlots] : 0;
+}
+
+/*-----------------------------------------------*/
+/* The pass a test runs in. Tests that failed or never finished last time come
+ * first. On a time budget, tests with no recorded time follow, as they may be
+ * new, and then the rest, cheapest first: each pass takes the tests whose time
+ * needs one more bit than the pass before. */
+static int UnityRunStatePassOf(const char* name)
+{
+    char flags = UnityNameSetFlags(name);
+    UNITY_UINT32 ms;
+    int pass = 2;
+
+    if (flags & UNITY_NAME_RERUN)
+    {
+        return 0;
+    }
+    if ((UnityRunStateLastPass == 1) || !(flags & (UNITY_NAME_PASSED | UNITY_NAME_TIMED)))
+    {
+        return 1;
+    }
+    for (ms = UnityRunStateTime(name); ms != 0; ms >>= 1)
+    {
+        pass++;
+    }
+    return pass;
+}
+
+/*-----------------------------------------------*/
+/* A test is rerun if it failed or never finished. When the last run stopped
+ * early, tests it never reached are rerun too. */
+int UnityRunStateSelects(const char* name)
+{
+    char flags = UnityNameSetFlags(name);
+
+    if ((UnityRunStateLastPass != 0) && (UnityRunStatePassOf(name) != UnityRunStatePass))
+    {
+        return 0;
+    }
+    if (!UnityRunStateRerun || (flags & UNITY_NAME_RERUN))
+    {
+        return 1;
+    }
+    return !(flags & UNITY_NAME_PASSED) && !UnityRunStateComplete;
+}
+
+/*-----------------------------------------------*/
+/* Notes that a test has an entry in "<path>.tmp", so its old one is dropped.
+ * If the names no longer fit, no old entries are kept, as they could be newer
+ * than the new ones. */
+static void UnityRunStateMark(const char* name, UNITY_UINT32 length)
+{
+    char* flags = UnityNameSetInsert(name, length);
+
+    if (flags == NULL)
+    {
+        UnityRunStateUnmarked = 1;
+        return;
+    }
+    *flags = (char)(*flags | UNITY_NAME_RAN);
+}
+
+/*-----------------------------------------------*/
+static void UnityRunStateUnmarkAll(void)
+{
+    UNITY_UINT32 i;
+
+    for (i = 0; i < UNITY_FILTER_FILE_SLOTS; i++)
+    {
+        if (UnityNameSlots[i] != 0)
+        {
+            UnityNameText[UnityNameSlots[i] - 1] &= (char)~UNITY_NAME_RAN;
+        }
+    }
+    UnityRunStateUnmarked = 0;
+}
+
+/*-----------------------------------------------*/
+/* Adds the entries of the state file for tests the run left out to the end of
+ * "<path>.tmp", closes it and renames it over the state file. A run that
+ * skipped tests marks the copied entries that passed as skipped, so they are
+ * rerun later. The old state file is left alone if the rename fails. */
+static void UnityRunStateMerge(FILE* file, int finished)
+{
+    char line[UNITY_FILTER_FILE_LINE_MAX];
+    FILE* previous = UnityRunStateUnmarked ? NULL : fopen(UnityRunStatePath, "r");
+
+    if (previous != NULL)
+    {
+        while (fgets(line, (int)sizeof(line), previous) != NULL)
+        {
+            UNITY_UINT32 length = 0;
+            const UNITY_UINT32* slot;
+
+            while ((line[length] != '\0') && (line[length] != '\t') && (line[length] != '\n'))
+            {
+                length++;
+            }
+            if (length == 0) /* the END of the previous run */
+            {
+                continue;
+            }
+            slot = UnityNameSetFind(line, length);
+            if ((slot != NULL) && (*slot != 0) && (UnityNameText[*slot - 1] & UNITY_NAME_RAN))
+            {
+                continue;
+            }
+            if (!finished && (line[length] == '\t') && ((line[length + 1] == 'P') || (line[length + 1] == 'I')))
+            {
+                const char* time = &line[length + 1];
+
+                while ((*time != '\0') && (*time != '\t') && (*time != '\n'))
+                {
+                    time++;
+                }
+                line[length] = '\0';
+                fputs(line, file);
+                fputs("\tSKIP", file);
+                fputs(time, file);
+            }
+            else
+            {
+                fputs(line, file);
+            }
+        }
+        fclose(previous);
+    }
+
+    if (finished)
+    {
+        fputs("\tEND\n", file);
+    }
+    if ((fclose(file) != 0) || (rename(UnityRunStateTempPath, UnityRunStatePath) != 0))
+    {
+        UnityPrint("ERROR: Cannot Replace Run State ");
+        UnityPrint(UnityRunStatePath);
+        UNITY_PRINT_EOL();
+    }
+    UnityRunStateUnmarkAll();
+}
+
+/*-----------------------------------------------*/
+/* Merges what a run that crashed left in "<path>.tmp" into the state file, its
+ * last test still without a status. */
+static void UnityRunStateRecover(void)
+{
+    char line[UNITY_FILTER_FILE_LINE_MAX];
+    FILE* file = fopen(UnityRunStateTempPath, "r");
+    int ended = 1;
+
+    if (file == NULL)
+    {
+        return;
+    }
+    while (fgets(line, (int)sizeof(line), file) != NULL)
+    {
+        UNITY_UINT32 length = 0;
+
+        while ((line[length] != '\0') && (line[length] != '\t') && (line[length] != '\n'))
+        {
+            length++;
+        }
+        if (length != 0)
+        {
+            UnityRunStateMark(line, length);
+        }
+        while (line[length] != '\0')
+        {
+            length++;
+        }
+        ended = (line[length - 1] == '\n');
+    }
+    fclose(file);
+
+    file = fopen(UnityRunStateTempPath, "a");
+    if (file == NULL)
+    {
+        UnityRunStateUnmarkAll();
+        return;
+    }
+    if (!ended)
+    {
+        fputs("\n", file);
+    }
+    UnityRunStateMerge(file, 0);
+}
+
+/*-----------------------------------------------*/
+void UnityRunStateStarted(void)
+{
+    if ((UnityRunStateFile == NULL) && (UnityRunStateTempPath[0] != '\0'))
+    {
+        UnityRunStateFile = fopen(UnityRunStateTempPath, "w");
+    }
+    if ((UnityRunStateFile != NULL) && (Unity.CurrentTestName != NULL))
+    {
+        UNITY_UINT32 length = 0;
+
+        while (Unity.CurrentTestName[length] != '\0')
         {
-            ptr_exp = (UNITY_PTR_ATTRIBUTE const unsigned char*)expected;
+            length++;
         }
+        UnityRunStateMark(Unity.CurrentTestName, length);
+        fputs(Unity.CurrentTestName, UnityRunStateFile);
+        fflush(UnityRunStateFile);
     }
 }
 
 /*-----------------------------------------------*/
-
-static union
+void UnityRunStateConcluded(void)
 {
-    UNITY_INT8 i8;
-    UNITY_INT16 i16;
-    UNITY_INT32 i32;
-#ifdef UNITY_SUPPORT_64
-    UNITY_INT64 i64;
-#endif
-#ifndef UNITY_EXCLUDE_FLOAT
-    float f;
-#endif
-#ifndef UNITY_EXCLUDE_DOUBLE
-    double d;
+#ifdef UNITY_EXEC_TIME_UNMEASURED
+    /* with no timer, a test is taken to last as long as it did when it was timed */
+    const UNITY_UINT32 ms = UnityRunStateTime(Unity.CurrentTestName);
+#else
+    const UNITY_UINT32 ms = (UNITY_UINT32)(UNITY_EXEC_TIME_MS());
 #endif
-} UnityQuickCompare;
 
-UNITY_INTERNAL_PTR UnityNumToPtr(const UNITY_INT num, const UNITY_UINT8 size)
+    UnityTimeSpent += ms;
+    if (UnityRunStateFile == NULL)
+    {
+        return;
+    }
+    if (Unity.CurrentTestIgnored)
+    {
+        fputs("\tIGNORE\t", UnityRunStateFile);
+    }
+    else if (Unity.CurrentTestFailed || (Unity.CurrentTestExpectFailures != 0))
+    {
+        fputs("\tFAIL\t", UnityRunStateFile);
+    }
+    else
+    {
+        fputs("\tPASS\t", UnityRunStateFile);
+    }
+    fprintf(UnityRunStateFile, "%lu\n", (unsigned long)ms);
+    fflush(UnityRunStateFile);
+}
+
+/*-----------------------------------------------*/
+/* A run that skipped tests is left unfinished, so they are rerun later */
+static void UnityRunStateFinish(int finished)
 {
-    switch(size)
+    if (UnityRunStateFile != NULL)
     {
-        case 1:
-            UnityQuickCompare.i8 = (UNITY_INT8)num;
-            return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.i8);
+        UnityRunStateMerge(UnityRunStateFile, finished);
+        UnityRunStateFile = NULL;
+    }
+}
 
-        case 2:
-            UnityQuickCompare.i16 = (UNITY_INT16)num;
-            return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.i16);
+#endif /* UNITY_INCLUDE_RUN_STATE */
 
-#ifdef UNITY_SUPPORT_64
-        case 8:
-            UnityQuickCompare.i64 = (UNITY_INT64)num;
-            return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.i64);
+/*-----------------------------------------------
+ * Test Sharding
+ *-----------------------------------------------*/
+
+/* Shards take turns over the tests in the order they are run, so each gets a
+ * near equal share. UnityShardCount is 0 when the run is not sharded. Tests
+ * with a known duration may instead be planned ahead, longest first. */
+static UNITY_UINT32 UnityShardIndex = 0;
+static UNITY_UINT32 UnityShardCount = 0;
+static UNITY_UINT32 UnityShardNext = 0;
+static UNITY_UINT32 UnityShardSeen = 0;
+#ifdef UNITY_INCLUDE_RUN_STATE
+static int UnityShardPlanned = 0;
+static UNITY_UINT32 UnityShardOrder[UNITY_FILTER_FILE_SLOTS];
 #endif
 
-        default: /* 4 bytes */
-            UnityQuickCompare.i32 = (UNITY_INT32)num;
-            return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.i32);
+/*-----------------------------------------------*/
+static int UnityOptionNumber(const char** spec, UNITY_UINT32* number)
+{
+    const char* digits = *spec;
+
+    *number = 0;
+    while ((**spec >= '0') && (**spec <= '9') && (*number < 100000u))
+    {
+        *number = (*number * 10) + (UNITY_UINT32)(**spec - '0');
+        (*spec)++;
     }
+    return (*spec != digits) && (*number < 100000u);
 }
 
-#ifndef UNITY_EXCLUDE_FLOAT
 /*-----------------------------------------------*/
-UNITY_INTERNAL_PTR UnityFloatToPtr(const float num)
+/* Takes "i/N", meaning run the i-th of N shards, counting from 1. NULL turns
+ * sharding off. Returns nonzero if spec is not a valid shard. */
+int UnityShardParse(const char* spec)
 {
-    UnityQuickCompare.f = num;
-    return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.f);
-}
+    UNITY_UINT32 index;
+    UNITY_UINT32 count;
+
+    UnityShardIndex = 0;
+    UnityShardCount = 0;
+    UnityShardNext = 0;
+    UnityShardSeen = 0;
+#ifdef UNITY_INCLUDE_RUN_STATE
+    UnityShardPlanned = 0;
 #endif
+    if (spec == NULL)
+    {
+        return 0;
+    }
 
-#ifndef UNITY_EXCLUDE_DOUBLE
+    if (!UnityOptionNumber(&spec, &index) || (*spec++ != '/') ||
+        !UnityOptionNumber(&spec, &count) || (*spec != '\0') ||
+        (index < 1) || (index > count))
+    {
+        return 1;
+    }
+    UnityShardIndex = index - 1;
+    UnityShardCount = count;
+    return 0;
+}
+
+#ifdef UNITY_INCLUDE_RUN_STATE
 /*-----------------------------------------------*/
-UNITY_INTERNAL_PTR UnityDoubleToPtr(const double num)
+/* Longer tests are planned first. Names break ties, so every shard agrees. */
+static int UnityShardPlansBefore(UNITY_UINT32 a, UNITY_UINT32 b)
 {
-    UnityQuickCompare.d = num;
-    return (UNITY_INTERNAL_PTR)(&UnityQuickCompare.d);
+    const char* name_a = &UnityNameText[UnityNameSlots[a]];
+    const char* name_b = &UnityNameText[UnityNameSlots[b]];
+
+    if (UnityNameTimes[a] != UnityNameTimes[b])
+    {
+        return UnityNameTimes[a] > UnityNameTimes[b];
+    }
+    while ((*name_a != '\0') && (*name_a == *name_b))
+    {
+        name_a++;
+        name_b++;
+    }
+    return (unsigned char)*name_a < (unsigned char)*name_b;
 }
-#endif
 
-/*-----------------------------------------------
- * Control Functions
- *-----------------------------------------------*/
+/*-----------------------------------------------*/
+static void UnityShardSiftDown(UNITY_UINT32 root, UNITY_UINT32 count)
+{
+    for (;;)
+    {
+        UNITY_UINT32 child = (2 * root) + 1;
+        UNITY_UINT32 swap;
+
+        if (child >= count)
+        {
+            return;
+        }
+        if (((child + 1) < count) && UnityShardPlansBefore(UnityShardOrder[child], UnityShardOrder[child + 1]))
+        {
+            child++;
+        }
+        if (!UnityShardPlansBefore(UnityShardOrder[root], UnityShardOrder[child]))
+        {
+            return;
+        }
+        swap = UnityShardOrder[root];
+        UnityShardOrder[root] = UnityShardOrder[child];
+        UnityShardOrder[child] = swap;
+        root = child;
+    }
+}
 
 /*-----------------------------------------------*/
-void UnityFail(const char* msg, const UNITY_LINE_TYPE line)
+/* Plans the tests found in a timing history across the shards, longest first,
+ * each going to the shard with the least work so far. Every shard makes the
+ * same plan and keeps the tests that fell to it. Tests missing from the
+ * history are still dealt out in turn as they come. An unsharded run only
+ * reads the history when it has a time budget to weigh the tests against. */
+int UnityShardPlan(const char* history)
 {
-    RETURN_IF_FAIL_OR_IGNORE;
+    UNITY_UINT loads[UNITY_MAX_PLANNED_SHARDS];
+    UNITY_UINT32 count = 0;
+    UNITY_UINT32 i;
 
-    UnityTestResultsBegin(Unity.TestFile, line);
-    UnityPrint(UnityStrFail);
-    if (msg != NULL)
+    if ((history == NULL) || ((UnityShardCount == 0) && (UnityTimeBudget == 0)))
     {
-        UNITY_OUTPUT_CHAR(':');
+        return 0;
+    }
+    if (UnityShardCount > UNITY_MAX_PLANNED_SHARDS)
+    {
+        UnityPrint("ERROR: Too Many Shards To Plan From Timing History");
+        UNITY_PRINT_EOL();
+        return 1;
+    }
+    switch (UnityRunStateRead(history, 1))
+    {
+        case 1:
+            break;
+        case -1:
+            UnityPrint("ERROR: Cannot Open Timing History ");
+            UnityPrint(history);
+            UNITY_PRINT_EOL();
+            return 1;
+        default:
+            return 1;
+    }
+    if (UnityShardCount == 0)
+    {
+        return 0;
+    }
 
-#ifndef UNITY_EXCLUDE_DETAILS
-        if (Unity.CurrentDetail1)
+    for (i = 0; i < UNITY_FILTER_FILE_SLOTS; i++)
+    {
+        if ((UnityNameSlots[i] != 0) && (UnityNameText[UnityNameSlots[i] - 1] & UNITY_NAME_TIMED))
         {
-            UnityPrint(UnityStrDetail1Name);
-            UnityPrint(Unity.CurrentDetail1);
-            if (Unity.CurrentDetail2)
+            UnityNameText[UnityNameSlots[i] - 1] &= (char)~UNITY_NAME_MINE;
+            UnityShardOrder[count++] = i;
+        }
+    }
+
+    /* heap sort into the order the tests are planned */
+    for (i = count / 2; i > 0; i--)
+    {
+        UnityShardSiftDown(i - 1, count);
+    }
+    for (i = count; i > 1; i--)
+    {
+        UNITY_UINT32 swap = UnityShardOrder[0];
+        UnityShardOrder[0] = UnityShardOrder[i - 1];
+        UnityShardOrder[i - 1] = swap;
+        UnityShardSiftDown(0, i - 1);
+    }
+
+    for (i = 0; i < UnityShardCount; i++)
+    {
+        loads[i] = 0;
+    }
+    for (i = 0; i < count; i++)
+    {
+        UNITY_UINT32 slot = UnityShardOrder[i];
+        UNITY_UINT32 lightest = 0;
+        UNITY_UINT32 shard;
+
+        for (shard = 1; shard < UnityShardCount; shard++)
+        {
+            if (loads[shard] < loads[lightest])
             {
-                UnityPrint(UnityStrDetail2Name);
-                UnityPrint(Unity.CurrentDetail2);
+                lightest = shard;
             }
-            UnityPrint(UnityStrSpacer);
         }
+        /* count every test as at least 1ms, so untimed tests still spread out */
+        loads[lightest] += (UNITY_UINT)UnityNameTimes[slot] + 1;
+        if (lightest == UnityShardIndex)
+        {
+            UnityNameText[UnityNameSlots[slot] - 1] |= UNITY_NAME_MINE;
+        }
+    }
+
+    UnityShardPlanned = 1;
+    return 0;
+}
 #endif
-        if (msg[0] != ' ')
+
+/*-----------------------------------------------*/
+/* Call once for each test that would otherwise run, in the order they run. */
+int UnityShardSelects(const char* name)
+{
+    UNITY_UINT32 turn;
+
+    if (UnityShardCount == 0)
+    {
+        return 1;
+    }
+    UnityShardSeen++;
+#ifdef UNITY_INCLUDE_RUN_STATE
+    if (UnityShardPlanned)
+    {
+        char flags = UnityNameSetFlags(name);
+
+        if (flags & UNITY_NAME_TIMED)
         {
-            UNITY_OUTPUT_CHAR(' ');
+            return (flags & UNITY_NAME_MINE) != 0;
         }
-        UnityPrint(msg);
     }
+#else
+    (void)name;
+#endif
+    turn = UnityShardNext++;
+    return (turn % UnityShardCount) == UnityShardIndex;
+}
 
-    UNITY_FAIL_AND_BAIL;
+#ifdef UNITY_INCLUDE_RUN_STATE
+/*-----------------------------------------------*/
+/* Appends text to a path, returning 0 if it does not fit. */
+static int UnityRunStatePathAdd(char* path, UNITY_UINT32* used, const char* text)
+{
+    while ((*text != '\0') && (*used < (UNITY_FILTER_FILE_LINE_MAX - 1)))
+    {
+        path[(*used)++] = *text++;
+    }
+    path[*used] = '\0';
+    return *text == '\0';
 }
 
 /*-----------------------------------------------*/
-void UnityIgnore(const char* msg, const UNITY_LINE_TYPE line)
+static int UnityRunStatePathAddNumber(char* path, UNITY_UINT32* used, UNITY_UINT32 number)
 {
-    RETURN_IF_FAIL_OR_IGNORE;
+    char digits[11];
+    UNITY_UINT32 i = sizeof(digits) - 1;
 
-    UnityTestResultsBegin(Unity.TestFile, line);
-    UnityPrint(UnityStrIgnore);
-    if (msg != NULL)
+    digits[i] = '\0';
+    do
     {
-        UNITY_OUTPUT_CHAR(':');
-        UNITY_OUTPUT_CHAR(' ');
-        UnityPrint(msg);
+        digits[--i] = (char)('0' + (number % 10));
+        number /= 10;
+    } while (number != 0);
+    return UnityRunStatePathAdd(path, used, &digits[i]);
+}
+
+/*-----------------------------------------------*/
+int UnityRunStateInit(const char* program, int rerun_failed, int fail_first)
+{
+#ifdef UNITY_RUN_STATE_FILE
+    const char* path = UNITY_RUN_STATE_FILE;
+    const char* suffix = "";
+#else
+    const char* path = program;
+    const char* suffix = UNITY_RUN_STATE_SUFFIX;
+#endif
+    UNITY_UINT32 used = 0;
+    int fits;
+
+    (void)program;
+    UnityRunStateRerun = rerun_failed;
+    UnityRunStatePass = 0;
+    if (UnityRunStateInOrder)
+    {
+        UnityRunStateLastPass = 0; /* tests that depend on others keep their order */
     }
-    UNITY_IGNORE_AND_BAIL;
+    else if (UnityTimeBudget != 0)
+    {
+        UnityRunStateLastPass = 2 + 32; /* a pass for each bit of a duration */
+    }
+    else
+    {
+        UnityRunStateLastPass = fail_first ? 1 : 0;
+    }
+    UnityTimeSpent = 0;
+    UnityRunStateComplete = 0;
+    UnityRunStatePath[0] = '\0';
+    UnityRunStateTempPath[0] = '\0';
+    UnityRunStateUnmarkAll();
+    if (path == NULL)
+    {
+        return 0;
+    }
+
+    fits = UnityRunStatePathAdd(UnityRunStatePath, &used, path);
+#ifndef UNITY_RUN_STATE_FILE
+    if (UnityShardCount != 0)
+    {
+        /* the shards of one program run at once, so each keeps a file of its own */
+        fits = fits && UnityRunStatePathAdd(UnityRunStatePath, &used, ".shard") &&
+               UnityRunStatePathAddNumber(UnityRunStatePath, &used, UnityShardIndex + 1) &&
+               UnityRunStatePathAdd(UnityRunStatePath, &used, "of") &&
+               UnityRunStatePathAddNumber(UnityRunStatePath, &used, UnityShardCount);
+    }
+#endif
+    fits = fits && UnityRunStatePathAdd(UnityRunStatePath, &used, suffix);
+    used = 0;
+    fits = fits && UnityRunStatePathAdd(UnityRunStateTempPath, &used, UnityRunStatePath) &&
+           UnityRunStatePathAdd(UnityRunStateTempPath, &used, ".tmp");
+    if (!fits)
+    {
+        UnityRunStatePath[0] = '\0';
+        UnityRunStateTempPath[0] = '\0';
+        UnityPrint("ERROR: Run State Path Too Long");
+        UNITY_PRINT_EOL();
+        return 1;
+    }
+
+    UnityRunStateRecover();
+    if (rerun_failed || fail_first || (UnityTimeBudget != 0))
+    {
+        /* failing first has nothing to reorder on a first run, but rerunning does need one */
+        int read = UnityRunStateRead(UnityRunStatePath, 0);
+        if ((read < 0) && rerun_failed)
+        {
+            UnityPrint("ERROR: No Previous Run State In ");
+            UnityPrint(UnityRunStatePath);
+            UNITY_PRINT_EOL();
+            return 1;
+        }
+        return (read == 0) ? 1 : 0;
+    }
+    return 0;
 }
 
 /*-----------------------------------------------*/
-void UnityMessage(const char* msg, const UNITY_LINE_TYPE line)
+/* Runners go over their tests again for as long as this returns nonzero. Each
+ * pass deals out the shards afresh, so they split the same way every pass. */
+int UnityRunStateNextPass(void)
 {
-    UnityTestResultsBegin(Unity.TestFile, line);
-    UnityPrint("INFO");
-    if (msg != NULL)
+    if (UnityRunStatePass >= UnityRunStateLastPass)
     {
-      UNITY_OUTPUT_CHAR(':');
-      UNITY_OUTPUT_CHAR(' ');
-      UnityPrint(msg);
+        return 0;
+    }
+    UnityRunStatePass++;
+    UnityShardNext = 0;
+    UnityShardSeen = 0;
+    return 1;
+}
+#endif
+
+/*-----------------------------------------------
+ * Fail Fast
+ *-----------------------------------------------*/
+
+/* Once this many tests have failed, the rest are skipped. 0 runs them all. */
+static UNITY_UINT32 UnityFailFastLimit = 0;
+static UNITY_UINT32 UnitySkippedTests = 0;
+
+/*-----------------------------------------------*/
+/* Takes the number of failures to stop after, or an empty string for 1. NULL
+ * turns fail fast off. Returns nonzero if spec is not a positive number. */
+int UnityFailFastParse(const char* spec)
+{
+    UNITY_UINT32 limit = 1;
+
+    UnityFailFastLimit = 0;
+    UnitySkippedTests = 0;
+    if (spec == NULL)
+    {
+        return 0;
+    }
+    if ((*spec != '\0') && (!UnityOptionNumber(&spec, &limit) || (*spec != '\0') || (limit == 0)))
+    {
+        return 1;
+    }
+    UnityFailFastLimit = limit;
+    return 0;
+}
+
+/*-----------------------------------------------*/
+/* Call once for each test that would otherwise run. */
+int UnityFailFastSelects(void)
+{
+    if ((UnityFailFastLimit != 0) && (Unity.TestFailures >= UnityFailFastLimit))
+    {
+        UnitySkippedTests++;
+        return 0;
+    }
+    return 1;
+}
+
+#ifdef UNITY_INCLUDE_RUN_STATE
+/*-----------------------------------------------
+ * Time Budget
+ *-----------------------------------------------*/
+
+/*-----------------------------------------------*/
+/* Takes a number of seconds, to at most three decimal places. NULL turns the
+ * budget off. Returns nonzero if spec is not a positive time. */
+int UnityTimeBudgetParse(const char* spec)
+{
+    UNITY_UINT32 seconds;
+    UNITY_UINT32 ms = 0;
+    UNITY_UINT32 digits = 0;
+
+    UnityTimeBudget = 0;
+    if (spec == NULL)
+    {
+        return 0;
+    }
+    if (!UnityOptionNumber(&spec, &seconds))
+    {
+        return 1;
+    }
+    if (*spec == '.')
+    {
+        spec++;
+        while ((*spec >= '0') && (*spec <= '9') && (digits < 3))
+        {
+            ms = (ms * 10) + (UNITY_UINT32)(*spec++ - '0');
+            digits++;
+        }
+        for (; digits < 3; digits++)
+        {
+            ms *= 10;
+        }
+    }
+    if ((*spec != '\0') || ((seconds == 0) && (ms == 0)))
+    {
+        return 1;
+    }
+    UnityTimeBudget = (seconds * 1000) + ms;
+    return 0;
+}
+
+/*-----------------------------------------------*/
+/* Call once for each test that would otherwise run. A test is skipped if the
+ * time it took last run no longer fits in what is left of the budget. */
+int UnityTimeBudgetSelects(const char* name)
+{
+    if ((UnityTimeBudget == 0) ||
+        ((UnityTimeSpent < UnityTimeBudget) && (UnityRunStateTime(name) <= (UnityTimeBudget - UnityTimeSpent))))
+    {
+        return 1;
     }
-    UNITY_PRINT_EOL();
+    UnitySkippedTests++;
+    return 0;
 }
+#endif
 
 /*-----------------------------------------------*/
 void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum)
@@ -1806,6 +4461,7 @@ void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int
     Unity.CurrentTestLineNumber = (UNITY_LINE_TYPE)FuncLineNum;
     Unity.NumberOfTests++;
     UNITY_CLR_DETAILS();
+    UNITY_RUN_STATE_STARTED();
     UNITY_EXEC_TIME_START();
     if (TEST_PROTECT())
     {
@@ -1837,6 +4493,16 @@ void UnityBegin(const char* filename)
     Unity.TestIgnores = 0;
     Unity.CurrentTestFailed = 0;
     Unity.CurrentTestIgnored = 0;
+    Unity.CurrentTestExpecting = 0;
+    Unity.CurrentTestExpectFailures = 0;
+    UnityShardNext = 0;
+    UnityShardSeen = 0;
+    UnitySkippedTests = 0;
+#ifdef UNITY_INCLUDE_RUN_STATE
+    /* a repeated run starts again from the first pass, with its whole budget */
+    UnityRunStatePass = 0;
+    UnityTimeSpent = 0;
+#endif
 
     UNITY_CLR_DETAILS();
     UNITY_OUTPUT_START();
@@ -1845,7 +4511,42 @@ void UnityBegin(const char* filename)
 /*-----------------------------------------------*/
 int UnityEnd(void)
 {
+#ifdef UNITY_INCLUDE_RUN_STATE
+    UnityRunStateFinish(UnitySkippedTests == 0);
+#endif
     UNITY_PRINT_EOL();
+    if (UnityShardCount != 0)
+    {
+        /* lets the results of all shards be checked against each other */
+        UnityPrint(UnityStrShard);
+        UnityPrintNumberUnsigned(UnityShardIndex + 1);
+        UNITY_OUTPUT_CHAR('/');
+        UnityPrintNumberUnsigned(UnityShardCount);
+        UnityPrint(UnityStrShardOf);
+        UnityPrintNumberUnsigned(UnityShardSeen);
+        UnityPrint(UnityStrShardTests);
+        UNITY_PRINT_EOL();
+    }
+    if (UnitySkippedTests != 0)
+    {
+#ifdef UNITY_INCLUDE_RUN_STATE
+        if ((UnityFailFastLimit == 0) || (Unity.TestFailures < UnityFailFastLimit))
+        {
+            UnityPrint(UnityStrTimeBudget);
+            UnityPrintNumberUnsigned(UnityTimeSpent);
+            UnityPrint(UnityStrTimeBudgetSpent);
+        }
+        else
+#endif
+        {
+            UnityPrint(UnityStrFailFast);
+            UnityPrintNumberUnsigned(Unity.TestFailures);
+            UnityPrint(UnityStrFailFastFailures);
+        }
+        UnityPrintNumberUnsigned(UnitySkippedTests);
+        UnityPrint(UnityStrFailFastSkipped);
+        UNITY_PRINT_EOL();
+    }
     UnityPrint(UnityStrBreaker);
     UNITY_PRINT_EOL();
     UnityPrintNumber((UNITY_INT)(Unity.NumberOfTests));
@@ -1877,16 +4578,360 @@ int UnityEnd(void)
  *-----------------------------------------------*/
 #ifdef UNITY_USE_COMMAND_LINE_ARGS
 
-char* UnityOptionIncludeNamed = NULL;
-char* UnityOptionExcludeNamed = NULL;
-int UnityVerbosity            = 1;
+int UnityVerbosity = 1;
+
+/* A compiled -n or -x pattern. Both parts index UnityFilterText, where each is
+ * stored wrapped in '*' so it still matches anywhere within a name. A pattern
+ * without a ':' has no file part and may match either the file or the test. */
+typedef struct
+{
+    UNITY_UINT32 File;
+    UNITY_UINT32 Test;
+    int Exclude;
+} UNITY_NAME_FILTER_T;
+
+#define UNITY_FILTER_NO_FILE ((UNITY_UINT32)0xFFFFFFFF)
+
+static char UnityFilterText[UNITY_FILTER_TEXT_SIZE];
+static UNITY_UINT32 UnityFilterTextUsed;
+static UNITY_NAME_FILTER_T UnityFilters[UNITY_MAX_NAME_FILTERS];
+static UNITY_UINT32 UnityFilterCount;
+static int UnityFilterHasInclude;
+
+/* Runners tag each test with a bitset, one bit per name in UnityTagNames.
+ * --tags turns the names asked for into two masks, so picking a test by its
+ * tags is just a couple of ANDs. */
+static const char* const* UnityTagNames = NULL;
+static UNITY_UINT32 UnityTagCount = 0;
+static UNITY_UINT32 UnityTagsIncluded;
+static UNITY_UINT32 UnityTagsExcluded;
+static int UnityTagsHaveInclude;
+
+/*-----------------------------------------------*/
+static int UnityFilterStore(const char* text, UNITY_UINT32 length, UNITY_UINT32* offset)
+{
+    UNITY_UINT32 i;
+
+    if ((UnityFilterTextUsed + length + 3) > UNITY_FILTER_TEXT_SIZE)
+    {
+        UnityPrint("ERROR: Test Filters Too Long");
+        UNITY_PRINT_EOL();
+        return 0;
+    }
+
+    *offset = UnityFilterTextUsed;
+    UnityFilterText[UnityFilterTextUsed++] = '*';
+    for (i = 0; i < length; i++)
+    {
+        UnityFilterText[UnityFilterTextUsed++] = text[i];
+    }
+    UnityFilterText[UnityFilterTextUsed++] = '*';
+    UnityFilterText[UnityFilterTextUsed++] = '\0';
+    return 1;
+}
+
+/*-----------------------------------------------*/
+static int UnityFilterAddPattern(const char* pattern, UNITY_UINT32 length, int exclude)
+{
+    UNITY_NAME_FILTER_T* filter;
+    UNITY_UINT32 colon = 0;
+
+    if (UnityFilterCount >= UNITY_MAX_NAME_FILTERS)
+    {
+        UnityPrint("ERROR: Too Many Test Filters");
+        UNITY_PRINT_EOL();
+        return 0;
+    }
+
+    while ((colon < length) && (pattern[colon] != ':'))
+    {
+        colon++;
+    }
+
+    filter = &UnityFilters[UnityFilterCount];
+    filter->Exclude = exclude;
+    if (colon == length)
+    {
+        filter->File = UNITY_FILTER_NO_FILE;
+        if (!UnityFilterStore(pattern, length, &filter->Test))
+        {
+            return 0;
+        }
+    }
+    else if (!UnityFilterStore(pattern, colon, &filter->File) ||
+             !UnityFilterStore(pattern + colon + 1, length - colon - 1, &filter->Test))
+    {
+        return 0;
+    }
+
+    UnityFilterCount++;
+    if (!exclude)
+    {
+        UnityFilterHasInclude = 1;
+    }
+    return 1;
+}
+
+#ifdef UNITY_INCLUDE_FILTER_FILE
+/*-----------------------------------------------*/
+static int UnityFilterAddName(const char* name, UNITY_UINT32 length, int exclude)
+{
+    char* flags = UnityNameSetAdd(name, length);
+
+    if (flags == NULL)
+    {
+        return 0;
+    }
+    *flags = (char)(*flags | (exclude ? UNITY_NAME_EXCLUDE : UNITY_NAME_INCLUDE));
+    if (!exclude)
+    {
+        UnityFilterHasInclude = 1;
+    }
+    return 1;
+}
+
+/*-----------------------------------------------*/
+/* Reads one test name or pattern per line. Blank lines and lines starting with
+ * '#' are skipped. Lines using '*', '?' or ':' become patterns; every other line
+ * is an exact test name, looked up in the hash set rather than scanned. */
+static int UnityFilterAddFile(const char* path, int exclude)
+{
+    char line[UNITY_FILTER_FILE_LINE_MAX];
+    FILE* file = fopen(path, "r");
+    int ok = 1;
+
+    if (file == NULL)
+    {
+        UnityPrint("ERROR: Cannot Open Filter File ");
+        UnityPrint(path);
+        UNITY_PRINT_EOL();
+        return 0;
+    }
+
+    while (ok && (fgets(line, (int)sizeof(line), file) != NULL))
+    {
+        UNITY_UINT32 start = 0;
+        UNITY_UINT32 end = 0;
+        UNITY_UINT32 i;
+        int is_pattern = 0;
+
+        while (line[end] != '\0')
+        {
+            end++;
+        }
+        if ((end == (UNITY_UINT32)(sizeof(line) - 1)) && (line[end - 1] != '\n'))
+        {
+            UnityPrint("ERROR: Filter File Line Too Long In ");
+            UnityPrint(path);
+            UNITY_PRINT_EOL();
+            ok = 0;
+            break;
+        }
+        while ((start < end) && ((line[start] == ' ') || (line[start] == '\t')))
+        {
+            start++;
+        }
+        while ((end > start) && ((line[end - 1] == ' ') || (line[end - 1] == '\t') ||
+                                 (line[end - 1] == '\r') || (line[end - 1] == '\n')))
+        {
+            end--;
+        }
+        if ((start == end) || (line[start] == '#'))
+        {
+            continue;
+        }
+
+        for (i = start; i < end; i++)
+        {
+            if ((line[i] == '*') || (line[i] == '?') || (line[i] == ':'))
+            {
+                is_pattern = 1;
+            }
+        }
+        if (is_pattern)
+        {
+            ok = UnityFilterAddPattern(&line[start], end - start, exclude);
+        }
+        else
+        {
+            ok = UnityFilterAddName(&line[start], end - start, exclude);
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+#endif
+
+/*-----------------------------------------------*/
+/* Splits an -n or -x argument into its comma or quote separated patterns. */
+static int UnityFilterAddList(const char* list, int exclude)
+{
+    while (*list != '\0')
+    {
+        UNITY_UINT32 length = 0;
+
+        while ((*list == ',') || (*list == '\'') || (*list == '"'))
+        {
+            list++;
+        }
+        while ((list[length] != '\0') && (list[length] != ',') && (list[length] != '\'') && (list[length] != '"'))
+        {
+            length++;
+        }
+
+        if (length == 0)
+        {
+            continue;
+        }
+        if (list[0] == '@')
+        {
+#ifdef UNITY_INCLUDE_FILTER_FILE
+            char path[UNITY_FILTER_FILE_LINE_MAX];
+            UNITY_UINT32 i;
+
+            if (length > (UNITY_UINT32)(sizeof(path)))
+            {
+                UnityPrint("ERROR: Filter File Path Too Long");
+                UNITY_PRINT_EOL();
+                return 0;
+            }
+            for (i = 1; i < length; i++)
+            {
+                path[i - 1] = list[i];
+            }
+            path[length - 1] = '\0';
+            if (!UnityFilterAddFile(path, exclude))
+            {
+                return 0;
+            }
+#else
+            UnityPrint("ERROR: Filter Files Need UNITY_INCLUDE_FILTER_FILE");
+            UNITY_PRINT_EOL();
+            return 0;
+#endif
+        }
+        else if (!UnityFilterAddPattern(list, length, exclude))
+        {
+            return 0;
+        }
+        list += length;
+    }
+    return 1;
+}
+
+/*-----------------------------------------------*/
+/* Returns what follows "--name" in arg: the value after an '=', or an empty
+ * string. Returns NULL when arg is some other option. */
+static const char* UnityLongOption(const char* arg, const char* name)
+{
+    arg += 2;
+    while ((*name != '\0') && (*arg == *name))
+    {
+        arg++;
+        name++;
+    }
+    if (*name != '\0')
+    {
+        return NULL;
+    }
+    if (*arg == '=')
+    {
+        return arg + 1;
+    }
+    return (*arg == '\0') ? arg : NULL;
+}
+
+/*-----------------------------------------------*/
+/* Takes tags separated by commas. A tag starting with '-' excludes the tests
+ * carrying it; any other, optionally starting with '+', includes them. A tag no
+ * test carries is not an error, since one binary may simply have none. */
+static void UnityTagsAddList(const char* list)
+{
+    while (*list != '\0')
+    {
+        UNITY_UINT32 length = 0;
+        UNITY_UINT32 bit = 0;
+        int exclude = (*list == '-');
+
+        if ((*list == '-') || (*list == '+'))
+        {
+            list++;
+        }
+        while ((list[length] != '\0') && (list[length] != ','))
+        {
+            length++;
+        }
+        if (length != 0)
+        {
+            UNITY_UINT32 i;
+
+            for (i = 0; i < UnityTagCount; i++)
+            {
+                const char* name = UnityTagNames[i];
+                UNITY_UINT32 j = 0;
+
+                while ((j < length) && (name[j] == list[j]))
+                {
+                    j++;
+                }
+                if ((j == length) && (name[j] == '\0'))
+                {
+                    bit = (UNITY_UINT32)1 << i;
+                    break;
+                }
+            }
+            if (exclude)
+            {
+                UnityTagsExcluded |= bit;
+            }
+            else
+            {
+                UnityTagsIncluded |= bit;
+                UnityTagsHaveInclude = 1;
+            }
+        }
+        list += length;
+        if (*list == ',')
+        {
+            list++;
+        }
+    }
+}
 
 /*-----------------------------------------------*/
 int UnityParseOptions(int argc, char** argv)
 {
     int i;
-    UnityOptionIncludeNamed = NULL;
-    UnityOptionExcludeNamed = NULL;
+    const char* value;
+#ifdef UNITY_INCLUDE_RUN_STATE
+    int rerun_failed = 0;
+    int fail_first = 0;
+    const char* timing_history = NULL;
+#endif
+    UnityFilterTextUsed = 0;
+    UnityFilterCount = 0;
+    UnityFilterHasInclude = 0;
+    UnityTagsIncluded = 0;
+    UnityTagsExcluded = 0;
+    UnityTagsHaveInclude = 0;
+#ifdef UNITY_INCLUDE_NAME_SET
+    UnityNameSetClear();
+#endif
+#ifndef UNITY_EXCLUDE_SHARD_ENV
+    if (UnityShardParse(getenv("UNITY_SHARD")) != 0)
+    {
+        UnityPrint("ERROR: UNITY_SHARD Must Be i/N With 1 <= i <= N");
+        UNITY_PRINT_EOL();
+        return 1;
+    }
+#else
+    (void)UnityShardParse(NULL);
+#endif
+    (void)UnityFailFastParse(NULL);
+#ifdef UNITY_INCLUDE_RUN_STATE
+    (void)UnityTimeBudgetParse(NULL);
+#endif
 
     for (i = 1; i < argc; i++)
     {
@@ -1896,15 +4941,21 @@ int UnityParseOptions(int argc, char** argv)
             {
                 case 'l': /* list tests */
                     return -1;
-                case 'n': /* include tests with name including this string */
+                case 'n': /* include tests with name matching this pattern (repeatable) */
                 case 'f': /* an alias for -n */
                     if (argv[i][2] == '=')
                     {
-                        UnityOptionIncludeNamed = &argv[i][3];
+                        if (!UnityFilterAddList(&argv[i][3], 0))
+                        {
+                            return 1;
+                        }
                     }
                     else if (++i < argc)
                     {
-                        UnityOptionIncludeNamed = argv[i];
+                        if (!UnityFilterAddList(argv[i], 0))
+                        {
+                            return 1;
+                        }
                     }
                     else
                     {
@@ -1913,20 +4964,31 @@ int UnityParseOptions(int argc, char** argv)
                         return 1;
                     }
                     break;
+#ifdef UNITY_INCLUDE_GOLDEN_FILE
+                case 'u': /* rewrite golden files instead of failing on mismatch */
+                    UnityGoldenFileUpdate = 1;
+                    break;
+#endif
                 case 'q': /* quiet */
                     UnityVerbosity = 0;
                     break;
                 case 'v': /* verbose */
                     UnityVerbosity = 2;
                     break;
-                case 'x': /* exclude tests with name including this string */
+                case 'x': /* exclude tests with name matching this pattern (repeatable) */
                     if (argv[i][2] == '=')
                     {
-                        UnityOptionExcludeNamed = &argv[i][3];
+                        if (!UnityFilterAddList(&argv[i][3], 1))
+                        {
+                            return 1;
+                        }
                     }
                     else if (++i < argc)
                     {
-                        UnityOptionExcludeNamed = argv[i];
+                        if (!UnityFilterAddList(argv[i], 1))
+                        {
+                            return 1;
+                        }
                     }
                     else
                     {
@@ -1935,6 +4997,90 @@ int UnityParseOptions(int argc, char** argv)
                         return 1;
                     }
                     break;
+                case '-': /* long options */
+                    value = UnityLongOption(argv[i], "tags");
+                    if (value != NULL)
+                    {
+                        UnityTagsAddList(value);
+                        break;
+                    }
+                    value = UnityLongOption(argv[i], "shard");
+                    if (value != NULL)
+                    {
+                        if (UnityShardParse(value) != 0)
+                        {
+                            UnityPrint("ERROR: --shard Must Be i/N With 1 <= i <= N");
+                            UNITY_PRINT_EOL();
+                            return 1;
+                        }
+                        break;
+                    }
+                    value = UnityLongOption(argv[i], "fail-fast");
+                    if (value != NULL)
+                    {
+                        if (UnityFailFastParse(value) != 0)
+                        {
+                            UnityPrint("ERROR: --fail-fast Must Be A Positive Number");
+                            UNITY_PRINT_EOL();
+                            return 1;
+                        }
+                        break;
+                    }
+                    if (UnityLongOption(argv[i], "fail-first") != NULL)
+                    {
+#ifdef UNITY_INCLUDE_RUN_STATE
+                        fail_first = 1;
+                        break;
+#else
+                        UnityPrint("ERROR: --fail-first Needs UNITY_INCLUDE_RUN_STATE");
+                        UNITY_PRINT_EOL();
+                        return 1;
+#endif
+                    }
+                    value = UnityLongOption(argv[i], "timing-history");
+                    if ((value != NULL) && (*value != '\0'))
+                    {
+#ifdef UNITY_INCLUDE_RUN_STATE
+                        timing_history = value;
+                        break;
+#else
+                        UnityPrint("ERROR: --timing-history Needs UNITY_INCLUDE_RUN_STATE");
+                        UNITY_PRINT_EOL();
+                        return 1;
+#endif
+                    }
+                    value = UnityLongOption(argv[i], "time-budget");
+                    if (value != NULL)
+                    {
+#ifdef UNITY_INCLUDE_RUN_STATE
+                        if (UnityTimeBudgetParse(value) != 0)
+                        {
+                            UnityPrint("ERROR: --time-budget Must Be A Positive Number Of Seconds");
+                            UNITY_PRINT_EOL();
+                            return 1;
+                        }
+                        break;
+#else
+                        UnityPrint("ERROR: --time-budget Needs UNITY_INCLUDE_RUN_STATE");
+                        UNITY_PRINT_EOL();
+                        return 1;
+#endif
+                    }
+                    if (UnityLongOption(argv[i], "rerun-failed") != NULL)
+                    {
+#ifdef UNITY_INCLUDE_RUN_STATE
+                        rerun_failed = 1;
+                        break;
+#else
+                        UnityPrint("ERROR: --rerun-failed Needs UNITY_INCLUDE_RUN_STATE");
+                        UNITY_PRINT_EOL();
+                        return 1;
+#endif
+                    }
+                    UnityPrint("ERROR: Unknown Option ");
+                    UnityPrint(argv[i]);
+                    UNITY_PRINT_EOL();
+                    return 1;
                 default:
                     UnityPrint("ERROR: Unknown Option ");
                     UNITY_OUTPUT_CHAR(argv[i][1]);
@@ -1944,141 +5090,100 @@ int UnityParseOptions(int argc, char** argv)
         }
     }
 
+#ifdef UNITY_INCLUDE_RUN_STATE
+    if (UnityRunStateInit(argv[0], rerun_failed, fail_first) != 0)
+    {
+        return 1;
+    }
+    return UnityShardPlan(timing_history);
+#else
     return 0;
+#endif
 }
 
 /*-----------------------------------------------*/
-int IsStringInBiggerString(const char* longstring, const char* shortstring)
+static int UnityFilterMatches(const UNITY_NAME_FILTER_T* filter, const char* file, const char* test)
 {
-    const char* lptr = longstring;
-    const char* sptr = shortstring;
-    const char* lnext = lptr;
+    const char* test_pattern = &UnityFilterText[filter->Test];
 
-    if (*sptr == '*')
+    if (filter->File == UNITY_FILTER_NO_FILE)
     {
-        return 1;
-    }
-
-    while (*lptr)
-    {
-        lnext = lptr + 1;
-
-        /* If they current bytes match, go on to the next bytes */
-        while (*lptr && *sptr && (*lptr == *sptr))
-        {
-            lptr++;
-            sptr++;
-
-            /* We're done if we match the entire string or up to a wildcard */
-            if (*sptr == '*')
-                return 1;
-            if (*sptr == ',')
-                return 1;
-            if (*sptr == '"')
-                return 1;
-            if (*sptr == '\'')
-                return 1;
-            if (*sptr == ':')
-                return 2;
-            if (*sptr == 0)
-                return 1;
-        }
-
-        /* Otherwise we start in the long pointer 1 character further and try again */
-        lptr = lnext;
-        sptr = shortstring;
+        return UnityGlobMatches(test_pattern, file) || UnityGlobMatches(test_pattern, test);
     }
-
-    return 0;
+    return UnityGlobMatches(&UnityFilterText[filter->File], file) && UnityGlobMatches(test_pattern, test);
 }
 
 /*-----------------------------------------------*/
-int UnityStringArgumentMatches(const char* str)
+int UnityTestMatches(void)
 {
-    int retval;
-    const char* ptr1;
-    const char* ptr2;
-    const char* ptrf;
+    const char* file = (Unity.TestFile != NULL) ? Unity.TestFile : "";
+    const char* test = (Unity.CurrentTestName != NULL) ? Unity.CurrentTestName : "";
+    int included = !UnityFilterHasInclude;
+    UNITY_UINT32 i;
 
-    /* Go through the options and get the substrings for matching one at a time */
-    ptr1 = str;
-    while (ptr1[0] != 0)
+#ifdef UNITY_INCLUDE_FILTER_FILE
     {
-        if ((ptr1[0] == '"') || (ptr1[0] == '\''))
-        {
-            ptr1++;
-        }
-
-        /* look for the start of the next partial */
-        ptr2 = ptr1;
-        ptrf = 0;
-        do
-        {
-            ptr2++;
-            if ((ptr2[0] == ':') && (ptr2[1] != 0) && (ptr2[0] != '\'') && (ptr2[0] != '"') && (ptr2[0] != ','))
-            {
-                ptrf = &ptr2[1];
-            }
-        } while ((ptr2[0] != 0) && (ptr2[0] != '\'') && (ptr2[0] != '"') && (ptr2[0] != ','));
+        char flags = UnityNameSetFlags(test);
 
-        while ((ptr2[0] != 0) && ((ptr2[0] == ':') || (ptr2[0] == '\'') || (ptr2[0] == '"') || (ptr2[0] == ',')))
+        if (flags & UNITY_NAME_EXCLUDE)
         {
-            ptr2++;
+            return 0;
         }
-
-        /* done if complete filename match */
-        retval = IsStringInBiggerString(Unity.TestFile, ptr1);
-        if (retval == 1)
+        if (flags & UNITY_NAME_INCLUDE)
         {
-            return retval;
+            included = 1;
         }
+    }
+#endif
 
-        /* done if testname match after filename partial match */
-        if ((retval == 2) && (ptrf != 0))
+    /* an exclude pattern always wins, so once included only those need checking */
+    for (i = 0; i < UnityFilterCount; i++)
+    {
+        if ((included && !UnityFilters[i].Exclude) ||
+            !UnityFilterMatches(&UnityFilters[i], file, test))
         {
-            if (IsStringInBiggerString(Unity.CurrentTestName, ptrf))
-            {
-                return 1;
-            }
+            continue;
         }
-
-        /* done if complete testname match */
-        if (IsStringInBiggerString(Unity.CurrentTestName, ptr1) == 1)
+        if (UnityFilters[i].Exclude)
         {
-            return 1;
+            return 0;
         }
-
-        ptr1 = ptr2;
+        included = 1;
     }
 
-    /* we couldn't find a match for any substrings */
-    return 0;
-}
-
-/*-----------------------------------------------*/
-int UnityTestMatches(void)
-{
-    /* Check if this test name matches the included test pattern */
-    int retval;
-    if (UnityOptionIncludeNamed)
+    /* shards split the tests the filters selected, before any are left out as
+     * already passing, so every shard of a run agrees on the split */
+    if (!included || !UnityShardSelects(test))
     {
-        retval = UnityStringArgumentMatches(UnityOptionIncludeNamed);
+        return 0;
     }
-    else
+#ifdef UNITY_INCLUDE_RUN_STATE
+    if (!UnityRunStateSelects(test) || !UnityFailFastSelects())
     {
-        retval = 1;
+        return 0;
     }
+    return UnityTimeBudgetSelects(test);
+#else
+    return UnityFailFastSelects();
+#endif
+}
+
+/*-----------------------------------------------*/
+/* Runners with tagged tests name their tags before parsing the options. */
+void UnitySetTagNames(const char* const* names, UNITY_UINT32 count)
+{
+    UnityTagNames = names;
+    UnityTagCount = (count < 32) ? count : 32;
+}
 
-    /* Check if this test name matches the excluded test pattern */
-    if (UnityOptionExcludeNamed)
+/*-----------------------------------------------*/
+int UnityTestTagged(UNITY_UINT32 tags)
+{
+    if (tags & UnityTagsExcluded)
     {
-        if (UnityStringArgumentMatches(UnityOptionExcludeNamed))
-        {
-            retval = 0;
-        }
+        return 0;
     }
-
-    return retval;
+    return !UnityTagsHaveInclude || ((tags & UnityTagsIncluded) != 0);
 }
 
 #endif /* UNITY_USE_COMMAND_LINE_ARGS */
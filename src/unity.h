@@ -52,6 +52,23 @@ int suiteTearDown(int num_failures);
 void resetTest(void);
 void verifyTest(void);
 
+/*-------------------------------------------------------
+ * Global State Snapshots
+ *-------------------------------------------------------*/
+
+/* With UNITY_INCLUDE_STATE_SNAPSHOT, call these from suiteSetUp to take a copy
+ * of global or static variables as they are then. The copy is written back
+ * after every test, so no test sees what an earlier one left behind.
+ * TEST_SNAPSHOT_STATE covers every variable marked UNITY_SNAPSHOT_STATE, in
+ * any file, where the toolchain supports it. */
+#ifdef UNITY_INCLUDE_STATE_SNAPSHOT
+#define TEST_SNAPSHOT(var)                 UnitySnapshotRegion((void*)&(var), sizeof(var))
+#define TEST_SNAPSHOT_REGION(start, bytes) UnitySnapshotRegion((start), (bytes))
+#ifdef UNITY_SNAPSHOT_STATE
+#define TEST_SNAPSHOT_STATE()              UnitySnapshotRegion(__start_unity_snapshot, (size_t)(__stop_unity_snapshot - __start_unity_snapshot))
+#endif
+#endif
+
 /*-------------------------------------------------------
  * Configuration Options
  *-------------------------------------------------------
@@ -114,6 +131,30 @@ void verifyTest(void);
  * which files should be linked to in order to perform a test. Use it like TEST_FILE("sandwiches.c") */
 #define TEST_FILE(a)
 
+/* This macro does nothing either. Put it before a test, like TEST_TAGS("slow, io"), and the runner generator
+ * tags the test so that command line runners can pick tests by tag with --tags=+slow,-io. */
+#ifdef UNITY_SUPPORT_VARIADIC_MACROS
+#define TEST_TAGS(...)
+#else
+#define TEST_TAGS(tags)
+#endif
+
+/* Also for the runner generator: TEST_DEPENDS_ON(test_Init) before a test runs it after test_Init, and skips it
+ * as ignored if test_Init failed. */
+#define TEST_DEPENDS_ON(test)
+
+/* And TEST_CASE_SOURCE(provider) before a test taking a const UNITY_TEST_CASE_T* runs it once for each case the
+ * provider makes at run time, such as one per enum value or per file in a directory. */
+#define TEST_CASE_SOURCE(provider)
+
+/* Like TEST_CASE, these make parameterized tests when the runner generator is given use_param_tests.
+ * TEST_RANGE(0, 20, 5) runs the test with 0, 5, 10, 15 and 20, and TEST_MATRIX([1, 2], ["a", "b"]) with every
+ * combination of the values listed for each argument. */
+#ifdef UNITY_SUPPORT_VARIADIC_MACROS
+#define TEST_RANGE(...)
+#define TEST_MATRIX(...)
+#endif
+
 /*-------------------------------------------------------
  * Test Asserts (simple)
  *-------------------------------------------------------*/
@@ -149,6 +190,11 @@ void verifyTest(void);
 #define TEST_ASSERT_BITS_LOW(mask, actual)                                                         UNITY_TEST_ASSERT_BITS((mask), (UNITY_UINT32)(0), (actual), __LINE__, NULL)
 #define TEST_ASSERT_BIT_HIGH(bit, actual)                                                          UNITY_TEST_ASSERT_BITS(((UNITY_UINT32)1 << (bit)), (UNITY_UINT32)(-1), (actual), __LINE__, NULL)
 #define TEST_ASSERT_BIT_LOW(bit, actual)                                                           UNITY_TEST_ASSERT_BITS(((UNITY_UINT32)1 << (bit)), (UNITY_UINT32)(0), (actual), __LINE__, NULL)
+#define TEST_ASSERT_BITS_ARRAY(mask, expected, actual, num_elements)                               UNITY_TEST_ASSERT_BITS_ARRAY((mask), (expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_BITS8_ARRAY(mask, expected, actual, num_elements)                              UNITY_TEST_ASSERT_BITS8_ARRAY((mask), (expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_BITS16_ARRAY(mask, expected, actual, num_elements)                             UNITY_TEST_ASSERT_BITS16_ARRAY((mask), (expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_BITS32_ARRAY(mask, expected, actual, num_elements)                             UNITY_TEST_ASSERT_BITS32_ARRAY((mask), (expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_BITS64_ARRAY(mask, expected, actual, num_elements)                             UNITY_TEST_ASSERT_BITS64_ARRAY((mask), (expected), (actual), (num_elements), __LINE__, NULL)
 
 /* Integer Greater Than/ Less Than (of all sizes) */
 #define TEST_ASSERT_GREATER_THAN(threshold, actual)                                                UNITY_TEST_ASSERT_GREATER_THAN_INT((threshold), (actual), __LINE__, NULL)
@@ -266,7 +312,15 @@ void verifyTest(void);
 #define TEST_ASSERT_EQUAL_PTR(expected, actual)                                                    UNITY_TEST_ASSERT_EQUAL_PTR((expected), (actual), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_STRING(expected, actual)                                                 UNITY_TEST_ASSERT_EQUAL_STRING((expected), (actual), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_STRING_LEN(expected, actual, len)                                        UNITY_TEST_ASSERT_EQUAL_STRING_LEN((expected), (actual), (len), __LINE__, NULL)
+#define TEST_ASSERT_STRING_CONTAINS(needle, actual)                                                UNITY_TEST_ASSERT_STRING_CONTAINS((needle), (actual), __LINE__, NULL)
+#define TEST_ASSERT_STRING_STARTS_WITH(prefix, actual)                                             UNITY_TEST_ASSERT_STRING_STARTS_WITH((prefix), (actual), __LINE__, NULL)
+#define TEST_ASSERT_STRING_ENDS_WITH(suffix, actual)                                               UNITY_TEST_ASSERT_STRING_ENDS_WITH((suffix), (actual), __LINE__, NULL)
+#define TEST_ASSERT_STRING_MATCHES_GLOB(pattern, actual)                                           UNITY_TEST_ASSERT_STRING_MATCHES_GLOB((pattern), (actual), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_MEMORY(expected, actual, len)                                            UNITY_TEST_ASSERT_EQUAL_MEMORY((expected), (actual), (len), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_MEMORY_MASKED(expected, actual, mask, len)                               UNITY_TEST_ASSERT_EQUAL_MEMORY_MASKED((expected), (actual), (mask), (len), __LINE__, NULL)
+#define TEST_ASSERT_MEMORY_HASH(expected_hash, actual, len)                                        UNITY_TEST_ASSERT_MEMORY_HASH((expected_hash), (actual), (len), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_HASH(expected_hash, state)                                               UNITY_TEST_ASSERT_EQUAL_HASH((expected_hash), (state), __LINE__, NULL)
+#define TEST_ASSERT_MATCHES_GOLDEN_FILE(path, actual, len)                                         UNITY_TEST_ASSERT_MATCHES_GOLDEN_FILE((path), (actual), (len), __LINE__, NULL)
 
 /* Arrays */
 #define TEST_ASSERT_EQUAL_INT_ARRAY(expected, actual, num_elements)                                UNITY_TEST_ASSERT_EQUAL_INT_ARRAY((expected), (actual), (num_elements), __LINE__, NULL)
@@ -290,6 +344,125 @@ void verifyTest(void);
 #define TEST_ASSERT_EQUAL_MEMORY_ARRAY(expected, actual, len, num_elements)                        UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY((expected), (actual), (len), (num_elements), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_CHAR_ARRAY(expected, actual, num_elements)                               UNITY_TEST_ASSERT_EQUAL_CHAR_ARRAY((expected), (actual), (num_elements), __LINE__, NULL)
 
+/* Strided Arrays (e.g. one field across an array of structs; a stride of 0 means packed) */
+#define TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                            UNITY_TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_INT8_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                           UNITY_TEST_ASSERT_EQUAL_INT8_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_INT16_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                          UNITY_TEST_ASSERT_EQUAL_INT16_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_INT32_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                          UNITY_TEST_ASSERT_EQUAL_INT32_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_INT64_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                          UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_UINT_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                           UNITY_TEST_ASSERT_EQUAL_UINT_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_UINT8_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                          UNITY_TEST_ASSERT_EQUAL_UINT8_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_UINT16_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                         UNITY_TEST_ASSERT_EQUAL_UINT16_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_UINT32_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                         UNITY_TEST_ASSERT_EQUAL_UINT32_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_UINT64_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                         UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_HEX8_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                           UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_HEX16_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                          UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_HEX32_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                          UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_HEX64_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                          UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_CHAR_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                           UNITY_TEST_ASSERT_EQUAL_CHAR_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                    UNITY_TEST_ASSERT_INT_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT8_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                   UNITY_TEST_ASSERT_INT8_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT16_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                  UNITY_TEST_ASSERT_INT16_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT32_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                  UNITY_TEST_ASSERT_INT32_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT64_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                  UNITY_TEST_ASSERT_INT64_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                   UNITY_TEST_ASSERT_UINT_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT8_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                  UNITY_TEST_ASSERT_UINT8_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT16_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                 UNITY_TEST_ASSERT_UINT16_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT32_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                 UNITY_TEST_ASSERT_UINT32_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT64_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                 UNITY_TEST_ASSERT_UINT64_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX8_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                   UNITY_TEST_ASSERT_HEX8_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX16_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                  UNITY_TEST_ASSERT_HEX16_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX32_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                  UNITY_TEST_ASSERT_HEX32_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX64_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                  UNITY_TEST_ASSERT_HEX64_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_CHAR_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements)                   UNITY_TEST_ASSERT_CHAR_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
+
+/* Unordered and Sorted Arrays (SUBSET: every element of actual is found in expected) */
+#define TEST_ASSERT_INT_ARRAY_PERMUTATION(expected, actual, num_elements)                                       UNITY_TEST_ASSERT_INT_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT8_ARRAY_PERMUTATION(expected, actual, num_elements)                                      UNITY_TEST_ASSERT_INT8_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT16_ARRAY_PERMUTATION(expected, actual, num_elements)                                     UNITY_TEST_ASSERT_INT16_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT32_ARRAY_PERMUTATION(expected, actual, num_elements)                                     UNITY_TEST_ASSERT_INT32_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT64_ARRAY_PERMUTATION(expected, actual, num_elements)                                     UNITY_TEST_ASSERT_INT64_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT_ARRAY_PERMUTATION(expected, actual, num_elements)                                      UNITY_TEST_ASSERT_UINT_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT8_ARRAY_PERMUTATION(expected, actual, num_elements)                                     UNITY_TEST_ASSERT_UINT8_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT16_ARRAY_PERMUTATION(expected, actual, num_elements)                                    UNITY_TEST_ASSERT_UINT16_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT32_ARRAY_PERMUTATION(expected, actual, num_elements)                                    UNITY_TEST_ASSERT_UINT32_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT64_ARRAY_PERMUTATION(expected, actual, num_elements)                                    UNITY_TEST_ASSERT_UINT64_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX_ARRAY_PERMUTATION(expected, actual, num_elements)                                       UNITY_TEST_ASSERT_HEX32_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX8_ARRAY_PERMUTATION(expected, actual, num_elements)                                      UNITY_TEST_ASSERT_HEX8_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX16_ARRAY_PERMUTATION(expected, actual, num_elements)                                     UNITY_TEST_ASSERT_HEX16_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX32_ARRAY_PERMUTATION(expected, actual, num_elements)                                     UNITY_TEST_ASSERT_HEX32_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX64_ARRAY_PERMUTATION(expected, actual, num_elements)                                     UNITY_TEST_ASSERT_HEX64_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_CHAR_ARRAY_PERMUTATION(expected, actual, num_elements)                                      UNITY_TEST_ASSERT_CHAR_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_STRING_ARRAY_PERMUTATION(expected, actual, num_elements)                                    UNITY_TEST_ASSERT_STRING_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                      UNITY_TEST_ASSERT_INT_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT8_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                     UNITY_TEST_ASSERT_INT8_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT16_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                    UNITY_TEST_ASSERT_INT16_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT32_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                    UNITY_TEST_ASSERT_INT32_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT64_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                    UNITY_TEST_ASSERT_INT64_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                     UNITY_TEST_ASSERT_UINT_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT8_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                    UNITY_TEST_ASSERT_UINT8_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT16_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                   UNITY_TEST_ASSERT_UINT16_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT32_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                   UNITY_TEST_ASSERT_UINT32_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT64_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                   UNITY_TEST_ASSERT_UINT64_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                      UNITY_TEST_ASSERT_HEX32_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX8_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                     UNITY_TEST_ASSERT_HEX8_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX16_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                    UNITY_TEST_ASSERT_HEX16_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX32_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                    UNITY_TEST_ASSERT_HEX32_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX64_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                    UNITY_TEST_ASSERT_HEX64_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_CHAR_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                     UNITY_TEST_ASSERT_CHAR_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_STRING_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements)                   UNITY_TEST_ASSERT_STRING_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                     UNITY_TEST_ASSERT_INT_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_INT8_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                    UNITY_TEST_ASSERT_INT8_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_INT16_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                   UNITY_TEST_ASSERT_INT16_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_INT32_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                   UNITY_TEST_ASSERT_INT32_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_INT64_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                   UNITY_TEST_ASSERT_INT64_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_UINT_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                    UNITY_TEST_ASSERT_UINT_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_UINT8_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                   UNITY_TEST_ASSERT_UINT8_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_UINT16_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                  UNITY_TEST_ASSERT_UINT16_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_UINT32_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                  UNITY_TEST_ASSERT_UINT32_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_UINT64_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                  UNITY_TEST_ASSERT_UINT64_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_HEX_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                     UNITY_TEST_ASSERT_HEX32_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_HEX8_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                    UNITY_TEST_ASSERT_HEX8_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_HEX16_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                   UNITY_TEST_ASSERT_HEX16_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_HEX32_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                   UNITY_TEST_ASSERT_HEX32_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_HEX64_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                   UNITY_TEST_ASSERT_HEX64_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_CHAR_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                    UNITY_TEST_ASSERT_CHAR_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_STRING_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots)                  UNITY_TEST_ASSERT_STRING_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_INT_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)    UNITY_TEST_ASSERT_INT_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_INT8_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)   UNITY_TEST_ASSERT_INT8_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_INT16_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)  UNITY_TEST_ASSERT_INT16_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_INT32_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)  UNITY_TEST_ASSERT_INT32_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_INT64_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)  UNITY_TEST_ASSERT_INT64_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_UINT_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)   UNITY_TEST_ASSERT_UINT_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_UINT8_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)  UNITY_TEST_ASSERT_UINT8_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_UINT16_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots) UNITY_TEST_ASSERT_UINT16_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_UINT32_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots) UNITY_TEST_ASSERT_UINT32_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_UINT64_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots) UNITY_TEST_ASSERT_UINT64_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_HEX_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)    UNITY_TEST_ASSERT_HEX32_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_HEX8_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)   UNITY_TEST_ASSERT_HEX8_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_HEX16_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)  UNITY_TEST_ASSERT_HEX16_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_HEX32_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)  UNITY_TEST_ASSERT_HEX32_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_HEX64_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)  UNITY_TEST_ASSERT_HEX64_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_CHAR_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots)   UNITY_TEST_ASSERT_CHAR_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_STRING_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots) UNITY_TEST_ASSERT_STRING_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, NULL)
+#define TEST_ASSERT_INT_ARRAY_SORTED(actual, num_elements)                                                      UNITY_TEST_ASSERT_INT_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT8_ARRAY_SORTED(actual, num_elements)                                                     UNITY_TEST_ASSERT_INT8_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT16_ARRAY_SORTED(actual, num_elements)                                                    UNITY_TEST_ASSERT_INT16_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT32_ARRAY_SORTED(actual, num_elements)                                                    UNITY_TEST_ASSERT_INT32_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_INT64_ARRAY_SORTED(actual, num_elements)                                                    UNITY_TEST_ASSERT_INT64_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT_ARRAY_SORTED(actual, num_elements)                                                     UNITY_TEST_ASSERT_UINT_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT8_ARRAY_SORTED(actual, num_elements)                                                    UNITY_TEST_ASSERT_UINT8_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT16_ARRAY_SORTED(actual, num_elements)                                                   UNITY_TEST_ASSERT_UINT16_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT32_ARRAY_SORTED(actual, num_elements)                                                   UNITY_TEST_ASSERT_UINT32_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_UINT64_ARRAY_SORTED(actual, num_elements)                                                   UNITY_TEST_ASSERT_UINT64_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX_ARRAY_SORTED(actual, num_elements)                                                      UNITY_TEST_ASSERT_HEX32_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX8_ARRAY_SORTED(actual, num_elements)                                                     UNITY_TEST_ASSERT_HEX8_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX16_ARRAY_SORTED(actual, num_elements)                                                    UNITY_TEST_ASSERT_HEX16_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX32_ARRAY_SORTED(actual, num_elements)                                                    UNITY_TEST_ASSERT_HEX32_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_HEX64_ARRAY_SORTED(actual, num_elements)                                                    UNITY_TEST_ASSERT_HEX64_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_CHAR_ARRAY_SORTED(actual, num_elements)                                                     UNITY_TEST_ASSERT_CHAR_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_STRING_ARRAY_SORTED(actual, num_elements)                                                   UNITY_TEST_ASSERT_STRING_ARRAY_SORTED((actual), (num_elements), __LINE__, NULL)
+
 /* Arrays Compared To Single Value */
 #define TEST_ASSERT_EACH_EQUAL_INT(expected, actual, num_elements)                                 UNITY_TEST_ASSERT_EACH_EQUAL_INT((expected), (actual), (num_elements), __LINE__, NULL)
 #define TEST_ASSERT_EACH_EQUAL_INT8(expected, actual, num_elements)                                UNITY_TEST_ASSERT_EACH_EQUAL_INT8((expected), (actual), (num_elements), __LINE__, NULL)
@@ -316,6 +489,7 @@ void verifyTest(void);
 #define TEST_ASSERT_FLOAT_WITHIN(delta, expected, actual)                                          UNITY_TEST_ASSERT_FLOAT_WITHIN((delta), (expected), (actual), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_FLOAT(expected, actual)                                                  UNITY_TEST_ASSERT_EQUAL_FLOAT((expected), (actual), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_FLOAT_ARRAY(expected, actual, num_elements)                              UNITY_TEST_ASSERT_EQUAL_FLOAT_ARRAY((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                          UNITY_TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
 #define TEST_ASSERT_EACH_EQUAL_FLOAT(expected, actual, num_elements)                               UNITY_TEST_ASSERT_EACH_EQUAL_FLOAT((expected), (actual), (num_elements), __LINE__, NULL)
 #define TEST_ASSERT_FLOAT_IS_INF(actual)                                                           UNITY_TEST_ASSERT_FLOAT_IS_INF((actual), __LINE__, NULL)
 #define TEST_ASSERT_FLOAT_IS_NEG_INF(actual)                                                       UNITY_TEST_ASSERT_FLOAT_IS_NEG_INF((actual), __LINE__, NULL)
@@ -330,6 +504,7 @@ void verifyTest(void);
 #define TEST_ASSERT_DOUBLE_WITHIN(delta, expected, actual)                                         UNITY_TEST_ASSERT_DOUBLE_WITHIN((delta), (expected), (actual), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_DOUBLE(expected, actual)                                                 UNITY_TEST_ASSERT_EQUAL_DOUBLE((expected), (actual), __LINE__, NULL)
 #define TEST_ASSERT_EQUAL_DOUBLE_ARRAY(expected, actual, num_elements)                             UNITY_TEST_ASSERT_EQUAL_DOUBLE_ARRAY((expected), (actual), (num_elements), __LINE__, NULL)
+#define TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED(expected, actual, stride, offset, num_elements)                         UNITY_TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, NULL)
 #define TEST_ASSERT_EACH_EQUAL_DOUBLE(expected, actual, num_elements)                              UNITY_TEST_ASSERT_EACH_EQUAL_DOUBLE((expected), (actual), (num_elements), __LINE__, NULL)
 #define TEST_ASSERT_DOUBLE_IS_INF(actual)                                                          UNITY_TEST_ASSERT_DOUBLE_IS_INF((actual), __LINE__, NULL)
 #define TEST_ASSERT_DOUBLE_IS_NEG_INF(actual)                                                      UNITY_TEST_ASSERT_DOUBLE_IS_NEG_INF((actual), __LINE__, NULL)
@@ -340,6 +515,42 @@ void verifyTest(void);
 #define TEST_ASSERT_DOUBLE_IS_NOT_NAN(actual)                                                      UNITY_TEST_ASSERT_DOUBLE_IS_NOT_NAN((actual), __LINE__, NULL)
 #define TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE(actual)                                              UNITY_TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE((actual), __LINE__, NULL)
 
+/* Soft Assertions (report the failure and keep running the test) */
+#define TEST_EXPECT(condition)                                                                     UNITY_TEST_EXPECT(UNITY_TEST_ASSERT(       (condition), __LINE__, " Expression Evaluated To FALSE"))
+#define TEST_EXPECT_TRUE(condition)                                                                UNITY_TEST_EXPECT(UNITY_TEST_ASSERT(       (condition), __LINE__, " Expected TRUE Was FALSE"))
+#define TEST_EXPECT_FALSE(condition)                                                               UNITY_TEST_EXPECT(UNITY_TEST_ASSERT(      !(condition), __LINE__, " Expected FALSE Was TRUE"))
+#define TEST_EXPECT_NULL(pointer)                                                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_NULL(    (pointer), __LINE__, " Expected NULL"))
+#define TEST_EXPECT_NOT_NULL(pointer)                                                              UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_NOT_NULL((pointer), __LINE__, " Expected Non-NULL"))
+#define TEST_EXPECT_EQUAL_INT(expected, actual)                                                    UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_INT8(expected, actual)                                                   UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT8((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_INT16(expected, actual)                                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT16((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_INT32(expected, actual)                                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT32((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_INT64(expected, actual)                                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT64((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_UINT(expected, actual)                                                   UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_UINT( (expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_UINT8(expected, actual)                                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_UINT8( (expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_UINT16(expected, actual)                                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_UINT16( (expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_UINT32(expected, actual)                                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_UINT32( (expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_UINT64(expected, actual)                                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_UINT64( (expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_HEX(expected, actual)                                                    UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_HEX32((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_HEX8(expected, actual)                                                   UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_HEX8( (expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_HEX16(expected, actual)                                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_HEX16((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_HEX32(expected, actual)                                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_HEX32((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_HEX64(expected, actual)                                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_HEX64((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_CHAR(expected, actual)                                                   UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_CHAR((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_PTR(expected, actual)                                                    UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_PTR((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_INT_WITHIN(delta, expected, actual)                                            UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_INT_WITHIN((delta), (expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_UINT_WITHIN(delta, expected, actual)                                           UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_UINT_WITHIN((delta), (expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_STRING(expected, actual)                                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_STRING((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_MEMORY(expected, actual, len)                                            UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_MEMORY((expected), (actual), (len), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_INT_ARRAY(expected, actual, num_elements)                                UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT_ARRAY((expected), (actual), (num_elements), __LINE__, NULL))
+#define TEST_EXPECT_FLOAT_WITHIN(delta, expected, actual)                                          UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_FLOAT_WITHIN((delta), (expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_FLOAT(expected, actual)                                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_FLOAT((expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_DOUBLE_WITHIN(delta, expected, actual)                                         UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_DOUBLE_WITHIN((delta), (expected), (actual), __LINE__, NULL))
+#define TEST_EXPECT_EQUAL_DOUBLE(expected, actual)                                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_DOUBLE((expected), (actual), __LINE__, NULL))
+
+/* Type-Generic (C11) */
+#define TEST_ASSERT_EQ(expected, actual)                                                           UNITY_TEST_ASSERT_EQ((expected), (actual), __LINE__, NULL)
+
 /* Shorthand */
 #ifdef UNITY_SHORTHAND_AS_OLD
 #define TEST_ASSERT_EQUAL(expected, actual)                                                        UNITY_TEST_ASSERT_EQUAL_INT((expected), (actual), __LINE__, NULL)
@@ -396,6 +607,11 @@ void verifyTest(void);
 #define TEST_ASSERT_BITS_LOW_MESSAGE(mask, actual, message)                                        UNITY_TEST_ASSERT_BITS((mask), (UNITY_UINT32)(0), (actual), __LINE__, (message))
 #define TEST_ASSERT_BIT_HIGH_MESSAGE(bit, actual, message)                                         UNITY_TEST_ASSERT_BITS(((UNITY_UINT32)1 << (bit)), (UNITY_UINT32)(-1), (actual), __LINE__, (message))
 #define TEST_ASSERT_BIT_LOW_MESSAGE(bit, actual, message)                                          UNITY_TEST_ASSERT_BITS(((UNITY_UINT32)1 << (bit)), (UNITY_UINT32)(0), (actual), __LINE__, (message))
+#define TEST_ASSERT_BITS_ARRAY_MESSAGE(mask, expected, actual, num_elements, message)              UNITY_TEST_ASSERT_BITS_ARRAY((mask), (expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_BITS8_ARRAY_MESSAGE(mask, expected, actual, num_elements, message)             UNITY_TEST_ASSERT_BITS8_ARRAY((mask), (expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_BITS16_ARRAY_MESSAGE(mask, expected, actual, num_elements, message)            UNITY_TEST_ASSERT_BITS16_ARRAY((mask), (expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_BITS32_ARRAY_MESSAGE(mask, expected, actual, num_elements, message)            UNITY_TEST_ASSERT_BITS32_ARRAY((mask), (expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_BITS64_ARRAY_MESSAGE(mask, expected, actual, num_elements, message)            UNITY_TEST_ASSERT_BITS64_ARRAY((mask), (expected), (actual), (num_elements), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_CHAR_MESSAGE(expected, actual, message)                                  UNITY_TEST_ASSERT_EQUAL_CHAR((expected), (actual), __LINE__, (message))
 
 /* Integer Greater Than/ Less Than (of all sizes) */
@@ -514,7 +730,15 @@ void verifyTest(void);
 #define TEST_ASSERT_EQUAL_PTR_MESSAGE(expected, actual, message)                                   UNITY_TEST_ASSERT_EQUAL_PTR((expected), (actual), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_STRING_MESSAGE(expected, actual, message)                                UNITY_TEST_ASSERT_EQUAL_STRING((expected), (actual), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_STRING_LEN_MESSAGE(expected, actual, len, message)                       UNITY_TEST_ASSERT_EQUAL_STRING_LEN((expected), (actual), (len), __LINE__, (message))
+#define TEST_ASSERT_STRING_CONTAINS_MESSAGE(needle, actual, message)                               UNITY_TEST_ASSERT_STRING_CONTAINS((needle), (actual), __LINE__, (message))
+#define TEST_ASSERT_STRING_STARTS_WITH_MESSAGE(prefix, actual, message)                            UNITY_TEST_ASSERT_STRING_STARTS_WITH((prefix), (actual), __LINE__, (message))
+#define TEST_ASSERT_STRING_ENDS_WITH_MESSAGE(suffix, actual, message)                              UNITY_TEST_ASSERT_STRING_ENDS_WITH((suffix), (actual), __LINE__, (message))
+#define TEST_ASSERT_STRING_MATCHES_GLOB_MESSAGE(pattern, actual, message)                          UNITY_TEST_ASSERT_STRING_MATCHES_GLOB((pattern), (actual), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, actual, len, message)                           UNITY_TEST_ASSERT_EQUAL_MEMORY((expected), (actual), (len), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_MEMORY_MASKED_MESSAGE(expected, actual, mask, len, message)              UNITY_TEST_ASSERT_EQUAL_MEMORY_MASKED((expected), (actual), (mask), (len), __LINE__, (message))
+#define TEST_ASSERT_MEMORY_HASH_MESSAGE(expected_hash, actual, len, message)                       UNITY_TEST_ASSERT_MEMORY_HASH((expected_hash), (actual), (len), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_HASH_MESSAGE(expected_hash, state, message)                              UNITY_TEST_ASSERT_EQUAL_HASH((expected_hash), (state), __LINE__, (message))
+#define TEST_ASSERT_MATCHES_GOLDEN_FILE_MESSAGE(path, actual, len, message)                        UNITY_TEST_ASSERT_MATCHES_GOLDEN_FILE((path), (actual), (len), __LINE__, (message))
 
 /* Arrays */
 #define TEST_ASSERT_EQUAL_INT_ARRAY_MESSAGE(expected, actual, num_elements, message)               UNITY_TEST_ASSERT_EQUAL_INT_ARRAY((expected), (actual), (num_elements), __LINE__, (message))
@@ -538,6 +762,125 @@ void verifyTest(void);
 #define TEST_ASSERT_EQUAL_MEMORY_ARRAY_MESSAGE(expected, actual, len, num_elements, message)       UNITY_TEST_ASSERT_EQUAL_MEMORY_ARRAY((expected), (actual), (len), (num_elements), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_CHAR_ARRAY_MESSAGE(expected, actual, num_elements, message)              UNITY_TEST_ASSERT_EQUAL_CHAR_ARRAY((expected), (actual), (num_elements), __LINE__, (message))
 
+/* Strided Arrays (e.g. one field across an array of structs; a stride of 0 means packed) */
+#define TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)           UNITY_TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_INT8_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)          UNITY_TEST_ASSERT_EQUAL_INT8_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_INT16_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)         UNITY_TEST_ASSERT_EQUAL_INT16_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_INT32_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)         UNITY_TEST_ASSERT_EQUAL_INT32_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_INT64_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)         UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_UINT_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)          UNITY_TEST_ASSERT_EQUAL_UINT_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_UINT8_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)         UNITY_TEST_ASSERT_EQUAL_UINT8_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_UINT16_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)        UNITY_TEST_ASSERT_EQUAL_UINT16_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_UINT32_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)        UNITY_TEST_ASSERT_EQUAL_UINT32_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_UINT64_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)        UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_HEX8_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)          UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_HEX16_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)         UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_HEX32_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)         UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_HEX64_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)         UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_CHAR_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)          UNITY_TEST_ASSERT_EQUAL_CHAR_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message)   UNITY_TEST_ASSERT_INT_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT8_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message)  UNITY_TEST_ASSERT_INT8_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT16_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message) UNITY_TEST_ASSERT_INT16_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT32_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message) UNITY_TEST_ASSERT_INT32_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT64_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message) UNITY_TEST_ASSERT_INT64_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message)  UNITY_TEST_ASSERT_UINT_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT8_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message) UNITY_TEST_ASSERT_UINT8_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT16_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message) UNITY_TEST_ASSERT_UINT16_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT32_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message) UNITY_TEST_ASSERT_UINT32_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT64_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message) UNITY_TEST_ASSERT_UINT64_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX8_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message)  UNITY_TEST_ASSERT_HEX8_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX16_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message) UNITY_TEST_ASSERT_HEX16_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX32_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message) UNITY_TEST_ASSERT_HEX32_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX64_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message) UNITY_TEST_ASSERT_HEX64_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_CHAR_ARRAY_WITHIN_STRIDED_MESSAGE(delta, expected, actual, stride, offset, num_elements, message)  UNITY_TEST_ASSERT_CHAR_ARRAY_WITHIN_STRIDED((delta), (expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
+
+/* Unordered and Sorted Arrays (SUBSET: every element of actual is found in expected) */
+#define TEST_ASSERT_INT_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                      UNITY_TEST_ASSERT_INT_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT8_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                     UNITY_TEST_ASSERT_INT8_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT16_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                    UNITY_TEST_ASSERT_INT16_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT32_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                    UNITY_TEST_ASSERT_INT32_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT64_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                    UNITY_TEST_ASSERT_INT64_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                     UNITY_TEST_ASSERT_UINT_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT8_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                    UNITY_TEST_ASSERT_UINT8_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT16_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                   UNITY_TEST_ASSERT_UINT16_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT32_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                   UNITY_TEST_ASSERT_UINT32_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT64_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                   UNITY_TEST_ASSERT_UINT64_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                      UNITY_TEST_ASSERT_HEX32_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX8_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                     UNITY_TEST_ASSERT_HEX8_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX16_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                    UNITY_TEST_ASSERT_HEX16_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX32_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                    UNITY_TEST_ASSERT_HEX32_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX64_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                    UNITY_TEST_ASSERT_HEX64_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_CHAR_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                     UNITY_TEST_ASSERT_CHAR_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_STRING_ARRAY_PERMUTATION_MESSAGE(expected, actual, num_elements, message)                   UNITY_TEST_ASSERT_STRING_ARRAY_PERMUTATION((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)     UNITY_TEST_ASSERT_INT_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_INT8_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)    UNITY_TEST_ASSERT_INT8_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_INT16_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)   UNITY_TEST_ASSERT_INT16_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_INT32_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)   UNITY_TEST_ASSERT_INT32_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_INT64_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)   UNITY_TEST_ASSERT_INT64_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)    UNITY_TEST_ASSERT_UINT_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT8_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)   UNITY_TEST_ASSERT_UINT8_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT16_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)  UNITY_TEST_ASSERT_UINT16_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT32_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)  UNITY_TEST_ASSERT_UINT32_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT64_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)  UNITY_TEST_ASSERT_UINT64_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)     UNITY_TEST_ASSERT_HEX32_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX8_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)    UNITY_TEST_ASSERT_HEX8_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX16_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)   UNITY_TEST_ASSERT_HEX16_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX32_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)   UNITY_TEST_ASSERT_HEX32_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX64_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)   UNITY_TEST_ASSERT_HEX64_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_CHAR_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)    UNITY_TEST_ASSERT_CHAR_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_STRING_ARRAY_SUBSET_MESSAGE(expected, actual, expected_elements, actual_elements, message)  UNITY_TEST_ASSERT_STRING_ARRAY_SUBSET((expected), (actual), (expected_elements), (actual_elements), __LINE__, (message))
+#define TEST_ASSERT_INT_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                     UNITY_TEST_ASSERT_INT_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_INT8_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                    UNITY_TEST_ASSERT_INT8_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_INT16_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                   UNITY_TEST_ASSERT_INT16_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_INT32_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                   UNITY_TEST_ASSERT_INT32_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_INT64_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                   UNITY_TEST_ASSERT_INT64_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_UINT_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                    UNITY_TEST_ASSERT_UINT_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_UINT8_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                   UNITY_TEST_ASSERT_UINT8_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_UINT16_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                  UNITY_TEST_ASSERT_UINT16_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_UINT32_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                  UNITY_TEST_ASSERT_UINT32_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_UINT64_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                  UNITY_TEST_ASSERT_UINT64_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_HEX_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                     UNITY_TEST_ASSERT_HEX32_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_HEX8_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                    UNITY_TEST_ASSERT_HEX8_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_HEX16_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                   UNITY_TEST_ASSERT_HEX16_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_HEX32_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                   UNITY_TEST_ASSERT_HEX32_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_HEX64_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                   UNITY_TEST_ASSERT_HEX64_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_CHAR_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                    UNITY_TEST_ASSERT_CHAR_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_STRING_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(expected, actual, num_elements, scratch, scratch_slots, message)                  UNITY_TEST_ASSERT_STRING_ARRAY_PERMUTATION_WITH_SCRATCH((expected), (actual), (num_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_INT_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)    UNITY_TEST_ASSERT_INT_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_INT8_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)   UNITY_TEST_ASSERT_INT8_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_INT16_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)  UNITY_TEST_ASSERT_INT16_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_INT32_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)  UNITY_TEST_ASSERT_INT32_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_INT64_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)  UNITY_TEST_ASSERT_INT64_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_UINT_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)   UNITY_TEST_ASSERT_UINT_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_UINT8_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)  UNITY_TEST_ASSERT_UINT8_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_UINT16_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message) UNITY_TEST_ASSERT_UINT16_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_UINT32_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message) UNITY_TEST_ASSERT_UINT32_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_UINT64_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message) UNITY_TEST_ASSERT_UINT64_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_HEX_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)    UNITY_TEST_ASSERT_HEX32_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_HEX8_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)   UNITY_TEST_ASSERT_HEX8_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_HEX16_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)  UNITY_TEST_ASSERT_HEX16_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_HEX32_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)  UNITY_TEST_ASSERT_HEX32_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_HEX64_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)  UNITY_TEST_ASSERT_HEX64_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_CHAR_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message)   UNITY_TEST_ASSERT_CHAR_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_STRING_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, message) UNITY_TEST_ASSERT_STRING_ARRAY_SUBSET_WITH_SCRATCH((expected), (actual), (expected_elements), (actual_elements), (scratch), (scratch_slots), __LINE__, (message))
+#define TEST_ASSERT_INT_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                     UNITY_TEST_ASSERT_INT_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT8_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                    UNITY_TEST_ASSERT_INT8_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT16_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                   UNITY_TEST_ASSERT_INT16_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT32_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                   UNITY_TEST_ASSERT_INT32_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_INT64_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                   UNITY_TEST_ASSERT_INT64_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                    UNITY_TEST_ASSERT_UINT_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT8_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                   UNITY_TEST_ASSERT_UINT8_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT16_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                  UNITY_TEST_ASSERT_UINT16_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT32_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                  UNITY_TEST_ASSERT_UINT32_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_UINT64_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                  UNITY_TEST_ASSERT_UINT64_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                     UNITY_TEST_ASSERT_HEX32_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX8_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                    UNITY_TEST_ASSERT_HEX8_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX16_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                   UNITY_TEST_ASSERT_HEX16_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX32_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                   UNITY_TEST_ASSERT_HEX32_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_HEX64_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                   UNITY_TEST_ASSERT_HEX64_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_CHAR_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                    UNITY_TEST_ASSERT_CHAR_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_STRING_ARRAY_SORTED_MESSAGE(actual, num_elements, message)                                  UNITY_TEST_ASSERT_STRING_ARRAY_SORTED((actual), (num_elements), __LINE__, (message))
+
 /* Arrays Compared To Single Value*/
 #define TEST_ASSERT_EACH_EQUAL_INT_MESSAGE(expected, actual, num_elements, message)                UNITY_TEST_ASSERT_EACH_EQUAL_INT((expected), (actual), (num_elements), __LINE__, (message))
 #define TEST_ASSERT_EACH_EQUAL_INT8_MESSAGE(expected, actual, num_elements, message)               UNITY_TEST_ASSERT_EACH_EQUAL_INT8((expected), (actual), (num_elements), __LINE__, (message))
@@ -564,6 +907,7 @@ void verifyTest(void);
 #define TEST_ASSERT_FLOAT_WITHIN_MESSAGE(delta, expected, actual, message)                         UNITY_TEST_ASSERT_FLOAT_WITHIN((delta), (expected), (actual), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_FLOAT_MESSAGE(expected, actual, message)                                 UNITY_TEST_ASSERT_EQUAL_FLOAT((expected), (actual), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_FLOAT_ARRAY_MESSAGE(expected, actual, num_elements, message)             UNITY_TEST_ASSERT_EQUAL_FLOAT_ARRAY((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)         UNITY_TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
 #define TEST_ASSERT_EACH_EQUAL_FLOAT_MESSAGE(expected, actual, num_elements, message)              UNITY_TEST_ASSERT_EACH_EQUAL_FLOAT((expected), (actual), (num_elements), __LINE__, (message))
 #define TEST_ASSERT_FLOAT_IS_INF_MESSAGE(actual, message)                                          UNITY_TEST_ASSERT_FLOAT_IS_INF((actual), __LINE__, (message))
 #define TEST_ASSERT_FLOAT_IS_NEG_INF_MESSAGE(actual, message)                                      UNITY_TEST_ASSERT_FLOAT_IS_NEG_INF((actual), __LINE__, (message))
@@ -578,6 +922,7 @@ void verifyTest(void);
 #define TEST_ASSERT_DOUBLE_WITHIN_MESSAGE(delta, expected, actual, message)                        UNITY_TEST_ASSERT_DOUBLE_WITHIN((delta), (expected), (actual), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_DOUBLE_MESSAGE(expected, actual, message)                                UNITY_TEST_ASSERT_EQUAL_DOUBLE((expected), (actual), __LINE__, (message))
 #define TEST_ASSERT_EQUAL_DOUBLE_ARRAY_MESSAGE(expected, actual, num_elements, message)            UNITY_TEST_ASSERT_EQUAL_DOUBLE_ARRAY((expected), (actual), (num_elements), __LINE__, (message))
+#define TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED_MESSAGE(expected, actual, stride, offset, num_elements, message)        UNITY_TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED((expected), (actual), (stride), (offset), (num_elements), __LINE__, (message))
 #define TEST_ASSERT_EACH_EQUAL_DOUBLE_MESSAGE(expected, actual, num_elements, message)             UNITY_TEST_ASSERT_EACH_EQUAL_DOUBLE((expected), (actual), (num_elements), __LINE__, (message))
 #define TEST_ASSERT_DOUBLE_IS_INF_MESSAGE(actual, message)                                         UNITY_TEST_ASSERT_DOUBLE_IS_INF((actual), __LINE__, (message))
 #define TEST_ASSERT_DOUBLE_IS_NEG_INF_MESSAGE(actual, message)                                     UNITY_TEST_ASSERT_DOUBLE_IS_NEG_INF((actual), __LINE__, (message))
@@ -588,6 +933,42 @@ void verifyTest(void);
 #define TEST_ASSERT_DOUBLE_IS_NOT_NAN_MESSAGE(actual, message)                                     UNITY_TEST_ASSERT_DOUBLE_IS_NOT_NAN((actual), __LINE__, (message))
 #define TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE_MESSAGE(actual, message)                             UNITY_TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE((actual), __LINE__, (message))
 
+/* Soft Assertions (report the failure and keep running the test) */
+#define TEST_EXPECT_MESSAGE(condition, message)                                                    UNITY_TEST_EXPECT(UNITY_TEST_ASSERT(       (condition), __LINE__, (message)))
+#define TEST_EXPECT_TRUE_MESSAGE(condition, message)                                               UNITY_TEST_EXPECT(UNITY_TEST_ASSERT(       (condition), __LINE__, (message)))
+#define TEST_EXPECT_FALSE_MESSAGE(condition, message)                                              UNITY_TEST_EXPECT(UNITY_TEST_ASSERT(      !(condition), __LINE__, (message)))
+#define TEST_EXPECT_NULL_MESSAGE(pointer, message)                                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_NULL(    (pointer), __LINE__, (message)))
+#define TEST_EXPECT_NOT_NULL_MESSAGE(pointer, message)                                             UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_NOT_NULL((pointer), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_INT_MESSAGE(expected, actual, message)                                   UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_INT8_MESSAGE(expected, actual, message)                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT8((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_INT16_MESSAGE(expected, actual, message)                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT16((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_INT32_MESSAGE(expected, actual, message)                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT32((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_INT64_MESSAGE(expected, actual, message)                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT64((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_UINT_MESSAGE(expected, actual, message)                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_UINT( (expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_UINT8_MESSAGE(expected, actual, message)                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_UINT8( (expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_UINT16_MESSAGE(expected, actual, message)                                UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_UINT16( (expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_UINT32_MESSAGE(expected, actual, message)                                UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_UINT32( (expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_UINT64_MESSAGE(expected, actual, message)                                UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_UINT64( (expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_HEX_MESSAGE(expected, actual, message)                                   UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_HEX32((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_HEX8_MESSAGE(expected, actual, message)                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_HEX8( (expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_HEX16_MESSAGE(expected, actual, message)                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_HEX16((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_HEX32_MESSAGE(expected, actual, message)                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_HEX32((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_HEX64_MESSAGE(expected, actual, message)                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_HEX64((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_CHAR_MESSAGE(expected, actual, message)                                  UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_CHAR((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_PTR_MESSAGE(expected, actual, message)                                   UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_PTR((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_INT_WITHIN_MESSAGE(delta, expected, actual, message)                           UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_INT_WITHIN((delta), (expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_UINT_WITHIN_MESSAGE(delta, expected, actual, message)                          UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_UINT_WITHIN((delta), (expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_STRING_MESSAGE(expected, actual, message)                                UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_STRING((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_MEMORY_MESSAGE(expected, actual, len, message)                           UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_MEMORY((expected), (actual), (len), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_INT_ARRAY_MESSAGE(expected, actual, num_elements, message)               UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_INT_ARRAY((expected), (actual), (num_elements), __LINE__, (message)))
+#define TEST_EXPECT_FLOAT_WITHIN_MESSAGE(delta, expected, actual, message)                         UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_FLOAT_WITHIN((delta), (expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_FLOAT_MESSAGE(expected, actual, message)                                 UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_FLOAT((expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_DOUBLE_WITHIN_MESSAGE(delta, expected, actual, message)                        UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_DOUBLE_WITHIN((delta), (expected), (actual), __LINE__, (message)))
+#define TEST_EXPECT_EQUAL_DOUBLE_MESSAGE(expected, actual, message)                                UNITY_TEST_EXPECT(UNITY_TEST_ASSERT_EQUAL_DOUBLE((expected), (actual), __LINE__, (message)))
+
+/* Type-Generic (C11) */
+#define TEST_ASSERT_EQ_MESSAGE(expected, actual, message)                                          UNITY_TEST_ASSERT_EQ((expected), (actual), __LINE__, (message))
+
 /* Shorthand */
 #ifdef UNITY_SHORTHAND_AS_OLD
 #define TEST_ASSERT_EQUAL_MESSAGE(expected, actual, message)                                       UNITY_TEST_ASSERT_EQUAL_INT((expected), (actual), __LINE__, (message))
@@ -27,6 +27,26 @@
 #include <stdarg.h>
 #endif
 
+#ifdef UNITY_INCLUDE_GOLDEN_FILE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#endif
+
+#if defined(UNITY_USE_COMMAND_LINE_ARGS) && !defined(UNITY_EXCLUDE_SHARD_ENV)
+#include <stdlib.h>
+#endif
+
+#ifdef UNITY_INCLUDE_STATE_SNAPSHOT
+#include <string.h>
+#endif
+
+/* Filter files and the last run state both keep test names in a hash set */
+#if (defined(UNITY_INCLUDE_FILTER_FILE) && defined(UNITY_USE_COMMAND_LINE_ARGS)) || defined(UNITY_INCLUDE_RUN_STATE)
+#define UNITY_INCLUDE_NAME_SET
+#include <stdio.h>
+#endif
+
 /* Unity Attempts to Auto-Detect Integer Types
  * Attempt 1: UINT_MAX, ULONG_MAX in <limits.h>, or default to 32 bits
  * Attempt 2: UINTPTR_MAX in <stdint.h>, or default to same size as long
@@ -309,6 +329,7 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
       #define UNITY_TIME_TYPE UNITY_UINT
       #define UNITY_EXEC_TIME_START() Unity.CurrentTestStartTime = UNITY_CLOCK_MS()
       #define UNITY_EXEC_TIME_STOP() Unity.CurrentTestStopTime = UNITY_CLOCK_MS()
+      #define UNITY_EXEC_TIME_MS() (Unity.CurrentTestStopTime - Unity.CurrentTestStartTime)
       #define UNITY_PRINT_EXEC_TIME() { \
         UNITY_UINT execTimeMs = (Unity.CurrentTestStopTime - Unity.CurrentTestStartTime); \
         UnityPrint(" ("); \
@@ -321,6 +342,7 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
       #define UNITY_GET_TIME(t) t = (clock_t)((clock() * 1000) / CLOCKS_PER_SEC)
       #define UNITY_EXEC_TIME_START() UNITY_GET_TIME(Unity.CurrentTestStartTime)
       #define UNITY_EXEC_TIME_STOP() UNITY_GET_TIME(Unity.CurrentTestStopTime)
+      #define UNITY_EXEC_TIME_MS() ((UNITY_UINT)(Unity.CurrentTestStopTime - Unity.CurrentTestStartTime))
       #define UNITY_PRINT_EXEC_TIME() { \
         UNITY_UINT execTimeMs = (Unity.CurrentTestStopTime - Unity.CurrentTestStartTime); \
         UnityPrint(" ("); \
@@ -333,6 +355,9 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
       #define UNITY_GET_TIME(t) clock_gettime(CLOCK_MONOTONIC, &t)
       #define UNITY_EXEC_TIME_START() UNITY_GET_TIME(Unity.CurrentTestStartTime)
       #define UNITY_EXEC_TIME_STOP() UNITY_GET_TIME(Unity.CurrentTestStopTime)
+      #define UNITY_EXEC_TIME_MS() \
+        ((UNITY_UINT)(((Unity.CurrentTestStopTime.tv_sec - Unity.CurrentTestStartTime.tv_sec) * 1000L) + \
+                      ((Unity.CurrentTestStopTime.tv_nsec - Unity.CurrentTestStartTime.tv_nsec) / 1000000L)))
       #define UNITY_PRINT_EXEC_TIME() { \
         UNITY_UINT execTimeMs = ((Unity.CurrentTestStopTime.tv_sec - Unity.CurrentTestStartTime.tv_sec) * 1000L); \
         execTimeMs += ((Unity.CurrentTestStopTime.tv_nsec - Unity.CurrentTestStartTime.tv_nsec) / 1000000L); \
@@ -360,6 +385,12 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
 #define UNITY_PRINT_EXEC_TIME() do{}while(0)
 #endif
 
+/* Milliseconds the current test took, or 0 when it is not being timed */
+#ifndef UNITY_EXEC_TIME_MS
+#define UNITY_EXEC_TIME_MS() ((UNITY_UINT)0)
+#define UNITY_EXEC_TIME_UNMEASURED
+#endif
+
 /*-------------------------------------------------------
  * Footprint
  *-------------------------------------------------------*/
@@ -372,12 +403,58 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
 #define UNITY_COUNTER_TYPE UNITY_UINT
 #endif
 
+/* Failed TEST_EXPECT_* assertions reported per test before the next one aborts it */
+#ifndef UNITY_EXPECT_MAX_FAILURES
+#define UNITY_EXPECT_MAX_FAILURES (16)
+#endif
+
+/* Longest stretch of the actual string printed when a string search assertion fails */
+#ifndef UNITY_STRING_WINDOW_LENGTH
+#define UNITY_STRING_WINDOW_LENGTH (64)
+#endif
+
+/* Longest case name a TEST_CASE_SOURCE provider may give, and longest test name made from it */
+#ifndef UNITY_TEST_CASE_NAME_LENGTH
+#define UNITY_TEST_CASE_NAME_LENGTH (64)
+#endif
+
+#ifndef UNITY_TEST_NAME_LENGTH
+#define UNITY_TEST_NAME_LENGTH (192)
+#endif
+
+/* Static hash table slots (8 bytes each) used by the unordered array asserts.
+ * Use a power of two; arrays that do not fit fail and ask for _WITH_SCRATCH,
+ * while a value of 0 falls back to a slower comparison that needs no scratch. */
+#ifndef UNITY_ARRAY_SCRATCH_SLOTS
+#define UNITY_ARRAY_SCRATCH_SLOTS (128)
+#endif
+
 /*-------------------------------------------------------
  * Internal Structs Needed
  *-------------------------------------------------------*/
 
 typedef void (*UnityTestFunction)(void);
 
+/* One slot of the hash table the unordered array asserts match elements in.
+ * The _WITH_SCRATCH asserts take an array of these from the caller. */
+typedef struct
+{
+    UNITY_UINT32 Index;
+    UNITY_UINT32 Count;
+} UNITY_ARRAY_SCRATCH_T;
+
+/* A case made at run time by a TEST_CASE_SOURCE provider. The provider is asked
+ * for Index 0, 1, 2... and fills in Data and Name for the test to use, or
+ * returns 0 when it has no case at Index. An empty Name names it by Index. */
+typedef struct
+{
+    UNITY_UINT32 Index;
+    const void* Data;
+    char Name[UNITY_TEST_CASE_NAME_LENGTH];
+} UNITY_TEST_CASE_T;
+
+typedef int (*UnityTestCaseSource)(UNITY_TEST_CASE_T* test_case);
+
 #define UNITY_DISPLAY_RANGE_INT  (0x10)
 #define UNITY_DISPLAY_RANGE_UINT (0x20)
 #define UNITY_DISPLAY_RANGE_HEX  (0x40)
@@ -446,6 +523,15 @@ typedef enum
     UNITY_ARRAY_UNKNOWN
 } UNITY_FLAGS_T;
 
+typedef enum
+{
+    UNITY_STRING_CONTAINS = 0,
+    UNITY_STRING_STARTS_WITH,
+    UNITY_STRING_ENDS_WITH,
+    UNITY_STRING_MATCHES_GLOB,
+    UNITY_STRING_SEARCH_UNKNOWN
+} UNITY_STRING_SEARCH_T;
+
 struct UNITY_STORAGE_T
 {
     const char* TestFile;
@@ -460,6 +546,8 @@ struct UNITY_STORAGE_T
     UNITY_COUNTER_TYPE TestIgnores;
     UNITY_COUNTER_TYPE CurrentTestFailed;
     UNITY_COUNTER_TYPE CurrentTestIgnored;
+    UNITY_COUNTER_TYPE CurrentTestExpecting;
+    UNITY_COUNTER_TYPE CurrentTestExpectFailures;
 #ifdef UNITY_INCLUDE_EXEC_TIME
     UNITY_TIME_TYPE CurrentTestStartTime;
     UNITY_TIME_TYPE CurrentTestStopTime;
@@ -553,6 +641,16 @@ void UnityAssertEqualIntArray(UNITY_INTERNAL_PTR expected,
                               const UNITY_DISPLAY_STYLE_T style,
                               const UNITY_FLAGS_T flags);
 
+void UnityAssertEqualIntArrayStrided(UNITY_INTERNAL_PTR expected,
+                                     UNITY_INTERNAL_PTR actual,
+                                     const UNITY_UINT32 num_elements,
+                                     const UNITY_UINT32 stride,
+                                     const UNITY_UINT32 offset,
+                                     const char* msg,
+                                     const UNITY_LINE_TYPE lineNumber,
+                                     const UNITY_DISPLAY_STYLE_T style,
+                                     const UNITY_FLAGS_T flags);
+
 void UnityAssertBits(const UNITY_INT mask,
                      const UNITY_INT expected,
                      const UNITY_INT actual,
@@ -570,6 +668,12 @@ void UnityAssertEqualStringLen(const char* expected,
                             const char* msg,
                             const UNITY_LINE_TYPE lineNumber);
 
+void UnityAssertStringSearch(const char* expected,
+                             const char* actual,
+                             const char* msg,
+                             const UNITY_LINE_TYPE lineNumber,
+                             const UNITY_STRING_SEARCH_T search);
+
 void UnityAssertEqualStringArray( UNITY_INTERNAL_PTR expected,
                                   const char** actual,
                                   const UNITY_UINT32 num_elements,
@@ -577,6 +681,36 @@ void UnityAssertEqualStringArray( UNITY_INTERNAL_PTR expected,
                                   const UNITY_LINE_TYPE lineNumber,
                                   const UNITY_FLAGS_T flags);
 
+void UnityAssertIntArrayUnordered(UNITY_INTERNAL_PTR expected,
+                                  UNITY_INTERNAL_PTR actual,
+                                  const UNITY_UINT32 expected_elements,
+                                  const UNITY_UINT32 actual_elements,
+                                  const char* msg,
+                                  const UNITY_LINE_TYPE lineNumber,
+                                  const UNITY_DISPLAY_STYLE_T style,
+                                  UNITY_ARRAY_SCRATCH_T* scratch,
+                                  const UNITY_UINT32 scratch_slots);
+
+void UnityAssertStringArrayUnordered(const char** expected,
+                                     const char** actual,
+                                     const UNITY_UINT32 expected_elements,
+                                     const UNITY_UINT32 actual_elements,
+                                     const char* msg,
+                                     const UNITY_LINE_TYPE lineNumber,
+                                     UNITY_ARRAY_SCRATCH_T* scratch,
+                                     const UNITY_UINT32 scratch_slots);
+
+void UnityAssertIntArraySorted(UNITY_INTERNAL_PTR actual,
+                               const UNITY_UINT32 num_elements,
+                               const char* msg,
+                               const UNITY_LINE_TYPE lineNumber,
+                               const UNITY_DISPLAY_STYLE_T style);
+
+void UnityAssertStringArraySorted(const char** actual,
+                                  const UNITY_UINT32 num_elements,
+                                  const char* msg,
+                                  const UNITY_LINE_TYPE lineNumber);
+
 void UnityAssertEqualMemory( UNITY_INTERNAL_PTR expected,
                              UNITY_INTERNAL_PTR actual,
                              const UNITY_UINT32 length,
@@ -585,6 +719,21 @@ void UnityAssertEqualMemory( UNITY_INTERNAL_PTR expected,
                              const UNITY_LINE_TYPE lineNumber,
                              const UNITY_FLAGS_T flags);
 
+void UnityAssertEqualMemoryMasked(UNITY_INTERNAL_PTR expected,
+                                  UNITY_INTERNAL_PTR actual,
+                                  UNITY_INTERNAL_PTR mask,
+                                  const UNITY_UINT32 length,
+                                  const char* msg,
+                                  const UNITY_LINE_TYPE lineNumber);
+
+void UnityAssertBitsArray(UNITY_INTERNAL_PTR mask,
+                          UNITY_INTERNAL_PTR expected,
+                          UNITY_INTERNAL_PTR actual,
+                          const UNITY_UINT32 num_elements,
+                          const char* msg,
+                          const UNITY_LINE_TYPE lineNumber,
+                          const UNITY_DISPLAY_STYLE_T style);
+
 void UnityAssertNumbersWithin(const UNITY_UINT delta,
                               const UNITY_INT expected,
                               const UNITY_INT actual,
@@ -601,8 +750,21 @@ void UnityAssertNumbersArrayWithin(const UNITY_UINT delta,
                                    const UNITY_DISPLAY_STYLE_T style,
                                    const UNITY_FLAGS_T flags);
 
+void UnityAssertNumbersArrayWithinStrided(const UNITY_UINT delta,
+                                          UNITY_INTERNAL_PTR expected,
+                                          UNITY_INTERNAL_PTR actual,
+                                          const UNITY_UINT32 num_elements,
+                                          const UNITY_UINT32 stride,
+                                          const UNITY_UINT32 offset,
+                                          const char* msg,
+                                          const UNITY_LINE_TYPE lineNumber,
+                                          const UNITY_DISPLAY_STYLE_T style,
+                                          const UNITY_FLAGS_T flags);
+
 void UnityFail(const char* message, const UNITY_LINE_TYPE line);
 void UnityIgnore(const char* message, const UNITY_LINE_TYPE line);
+void UnitySkipDependentTest(const char* prerequisite);
+const char* UnityTestCaseNext(UnityTestCaseSource source, UNITY_TEST_CASE_T* test_case, const char* test, UNITY_UINT32 index);
 void UnityMessage(const char* message, const UNITY_LINE_TYPE line);
 
 #ifndef UNITY_EXCLUDE_FLOAT
@@ -619,6 +781,15 @@ void UnityAssertEqualFloatArray(UNITY_PTR_ATTRIBUTE const UNITY_FLOAT* expected,
                                 const UNITY_LINE_TYPE lineNumber,
                                 const UNITY_FLAGS_T flags);
 
+void UnityAssertEqualFloatArrayStrided(UNITY_PTR_ATTRIBUTE const UNITY_FLOAT* expected,
+                                       UNITY_INTERNAL_PTR actual,
+                                       const UNITY_UINT32 num_elements,
+                                       const UNITY_UINT32 stride,
+                                       const UNITY_UINT32 offset,
+                                       const char* msg,
+                                       const UNITY_LINE_TYPE lineNumber,
+                                       const UNITY_FLAGS_T flags);
+
 void UnityAssertFloatSpecial(const UNITY_FLOAT actual,
                              const char* msg,
                              const UNITY_LINE_TYPE lineNumber,
@@ -639,6 +810,15 @@ void UnityAssertEqualDoubleArray(UNITY_PTR_ATTRIBUTE const UNITY_DOUBLE* expecte
                                  const UNITY_LINE_TYPE lineNumber,
                                  const UNITY_FLAGS_T flags);
 
+void UnityAssertEqualDoubleArrayStrided(UNITY_PTR_ATTRIBUTE const UNITY_DOUBLE* expected,
+                                        UNITY_INTERNAL_PTR actual,
+                                        const UNITY_UINT32 num_elements,
+                                        const UNITY_UINT32 stride,
+                                        const UNITY_UINT32 offset,
+                                        const char* msg,
+                                        const UNITY_LINE_TYPE lineNumber,
+                                        const UNITY_FLAGS_T flags);
+
 void UnityAssertDoubleSpecial(const UNITY_DOUBLE actual,
                               const char* msg,
                               const UNITY_LINE_TYPE lineNumber,
@@ -657,6 +837,58 @@ UNITY_INTERNAL_PTR UnityFloatToPtr(const float num);
 UNITY_INTERNAL_PTR UnityDoubleToPtr(const double num);
 #endif
 
+/*-------------------------------------------------------
+ * Streaming Memory Hash (XXH64, seed 0)
+ *-------------------------------------------------------*/
+
+#ifdef UNITY_SUPPORT_64
+typedef struct
+{
+    UNITY_UINT64  TotalLength;
+    UNITY_UINT64  Lanes[4];
+    unsigned char Pending[32];
+    UNITY_UINT32  PendingLength;
+} UNITY_HASH_T;
+
+void UnityHash_Init(UNITY_HASH_T* state);
+void UnityHash_Update(UNITY_HASH_T* state, UNITY_INTERNAL_PTR data, const UNITY_UINT length);
+UNITY_UINT64 UnityHash_Final(const UNITY_HASH_T* state);
+UNITY_UINT64 UnityHash(UNITY_INTERNAL_PTR data, const UNITY_UINT length);
+
+void UnityAssertEqualHash(const UNITY_UINT64 expected,
+                          const UNITY_UINT64 actual,
+                          const char* msg,
+                          const UNITY_LINE_TYPE lineNumber);
+
+void UnityAssertMemoryHash(const UNITY_UINT64 expected,
+                           UNITY_INTERNAL_PTR actual,
+                           const UNITY_UINT length,
+                           const char* msg,
+                           const UNITY_LINE_TYPE lineNumber);
+#endif
+
+/*-------------------------------------------------------
+ * Golden File Assertions
+ *-------------------------------------------------------*/
+
+#ifdef UNITY_INCLUDE_GOLDEN_FILE
+#ifndef UNITY_GOLDEN_FILE_BUFFER_SIZE
+#define UNITY_GOLDEN_FILE_BUFFER_SIZE (256)
+#endif
+
+#ifndef UNITY_GOLDEN_FILE_PATH_MAX
+#define UNITY_GOLDEN_FILE_PATH_MAX (256)
+#endif
+
+extern int UnityGoldenFileUpdate;
+
+void UnityAssertMatchesGoldenFile(const char* path,
+                                  UNITY_INTERNAL_PTR actual,
+                                  const UNITY_UINT length,
+                                  const char* msg,
+                                  const UNITY_LINE_TYPE lineNumber);
+#endif
+
 /*-------------------------------------------------------
  * Error Strings We Might Need
  *-------------------------------------------------------*/
@@ -670,6 +902,8 @@ extern const char UnityStrErrFloat[];
 extern const char UnityStrErrDouble[];
 extern const char UnityStrErr64[];
 extern const char UnityStrErrShorthand[];
+extern const char UnityStrErrGoldenFile[];
+extern const char UnityStrErrGeneric[];
 
 /*-------------------------------------------------------
  * Test Running Macros
@@ -738,8 +972,116 @@ extern const char UnityStrErrShorthand[];
  *-----------------------------------------------*/
 
 #ifdef UNITY_USE_COMMAND_LINE_ARGS
+/* Every -n and -x pattern is compiled into these fixed tables once, when the
+ * options are parsed, so matching a test never re-parses the command line. */
+#ifndef UNITY_MAX_NAME_FILTERS
+#define UNITY_MAX_NAME_FILTERS (32)
+#endif
+
+#ifndef UNITY_FILTER_TEXT_SIZE
+#define UNITY_FILTER_TEXT_SIZE (1024)
+#endif
+
 int UnityParseOptions(int argc, char** argv);
 int UnityTestMatches(void);
+void UnitySetTagNames(const char* const* names, UNITY_UINT32 count);
+int UnityTestTagged(UNITY_UINT32 tags);
+#endif
+
+#ifdef UNITY_INCLUDE_NAME_SET
+/* Exact test names read from a filter file or the last run state live in a
+ * hash set of this many slots. Use a power of two, comfortably larger than the
+ * number of names. */
+#ifndef UNITY_FILTER_FILE_SLOTS
+#define UNITY_FILTER_FILE_SLOTS (8192)
+#endif
+
+#ifndef UNITY_FILTER_FILE_TEXT_SIZE
+#define UNITY_FILTER_FILE_TEXT_SIZE (131072)
+#endif
+
+#ifndef UNITY_FILTER_FILE_LINE_MAX
+#define UNITY_FILTER_FILE_LINE_MAX (256)
+#endif
+#endif
+
+/*-----------------------------------------------
+ * Test Sharding
+ *-----------------------------------------------*/
+
+int UnityShardParse(const char* spec);
+int UnityShardSelects(const char* name);
+
+/*-----------------------------------------------
+ * Fail Fast
+ *-----------------------------------------------*/
+
+int UnityFailFastParse(const char* spec);
+int UnityFailFastSelects(void);
+
+/*-----------------------------------------------
+ * Last Run State
+ *-----------------------------------------------*/
+
+#ifdef UNITY_INCLUDE_RUN_STATE
+/* Unless UNITY_RUN_STATE_FILE names the file outright, the state of the last run
+ * is kept next to the test executable, in a file with this suffix. */
+#ifndef UNITY_RUN_STATE_SUFFIX
+#define UNITY_RUN_STATE_SUFFIX ".last_run"
+#endif
+
+/* A timing history can plan the tests of at most this many shards */
+#ifndef UNITY_MAX_PLANNED_SHARDS
+#define UNITY_MAX_PLANNED_SHARDS (256)
+#endif
+
+int  UnityRunStateInit(const char* program, int rerun_failed, int fail_first);
+void UnityRunStateKeepOrder(void);
+int  UnityRunStateSelects(const char* name);
+void UnityRunStateStarted(void);
+void UnityRunStateConcluded(void);
+int  UnityShardPlan(const char* history);
+int  UnityRunStateNextPass(void);
+int  UnityTimeBudgetParse(const char* spec);
+int  UnityTimeBudgetSelects(const char* name);
+#define UNITY_RUN_STATE_STARTED() UnityRunStateStarted()
+#define UNITY_RUN_STATE_NEXT_PASS() UnityRunStateNextPass()
+#define UNITY_RUN_STATE_KEEP_ORDER() UnityRunStateKeepOrder()
+#else
+#define UNITY_RUN_STATE_STARTED() do{}while(0)
+#define UNITY_RUN_STATE_NEXT_PASS() 0
+#define UNITY_RUN_STATE_KEEP_ORDER() do{}while(0)
+#endif
+
+/*-----------------------------------------------
+ * State Snapshots
+ *-----------------------------------------------*/
+
+#ifdef UNITY_INCLUDE_STATE_SNAPSHOT
+/* Snapshots of global state are copied into one static buffer of this many
+ * bytes, and cover at most this many separate regions. */
+#ifndef UNITY_SNAPSHOT_BYTES
+#define UNITY_SNAPSHOT_BYTES (4096)
+#endif
+
+#ifndef UNITY_SNAPSHOT_REGIONS
+#define UNITY_SNAPSHOT_REGIONS (16)
+#endif
+
+/* With GNU toolchains on ELF targets, variables marked UNITY_SNAPSHOT_STATE
+ * are gathered into one section, which the linker brackets with these. */
+#if defined(__GNUC__) && defined(__ELF__)
+#define UNITY_SNAPSHOT_STATE __attribute__((section("unity_snapshot")))
+extern char __start_unity_snapshot[];
+extern char __stop_unity_snapshot[];
+#endif
+
+int  UnitySnapshotRegion(void* start, size_t bytes);
+void UnitySnapshotRestore(void);
+void UnitySnapshotClear(void);
+#define UNITY_SNAPSHOT_RESTORE() UnitySnapshotRestore()
+#else
+#define UNITY_SNAPSHOT_RESTORE() do{}while(0)
 #endif
 
 /*-------------------------------------------------------
@@ -753,23 +1095,48 @@ int UnityTestMatches(void);
  * Test Asserts
  *-------------------------------------------------------*/
 
+/* With UNITY_INLINE_PASS_PATH, integer equality is checked in the caller and
+ * UnityAssertEqualNumber is only called to report a failure. Each argument is
+ * still evaluated exactly once. */
+#ifdef UNITY_INLINE_PASS_PATH
+#define UNITY_TEST_ASSERT_EQUAL_NUMBER(expected, actual, message, line, style) \
+    do { \
+        const UNITY_INT unityInlineExpected = (expected); \
+        const UNITY_INT unityInlineActual = (actual); \
+        if (unityInlineExpected != unityInlineActual) \
+        { \
+            UnityAssertEqualNumber(unityInlineExpected, unityInlineActual, (message), (line), (style)); \
+        } \
+    } while (0)
+#else
+#define UNITY_TEST_ASSERT_EQUAL_NUMBER(expected, actual, message, line, style) \
+    UnityAssertEqualNumber((expected), (actual), (message), (line), (style))
+#endif
+
+/* Runs any UNITY_TEST_ASSERT_* so that a failure is reported but the test goes on */
+#define UNITY_TEST_EXPECT(assertion) do { Unity.CurrentTestExpecting = 1; assertion; Unity.CurrentTestExpecting = 0; } while (0)
+
 #define UNITY_TEST_ASSERT(condition, line, message)                                              if (condition) {} else {UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), (message));}
 #define UNITY_TEST_ASSERT_NULL(pointer, line, message)                                           UNITY_TEST_ASSERT(((pointer) == NULL),  (UNITY_LINE_TYPE)(line), (message))
 #define UNITY_TEST_ASSERT_NOT_NULL(pointer, line, message)                                       UNITY_TEST_ASSERT(((pointer) != NULL),  (UNITY_LINE_TYPE)(line), (message))
 
-#define UNITY_TEST_ASSERT_EQUAL_INT(expected, actual, line, message)                             UnityAssertEqualNumber((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT)
-#define UNITY_TEST_ASSERT_EQUAL_INT8(expected, actual, line, message)                            UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8)
-#define UNITY_TEST_ASSERT_EQUAL_INT16(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)(expected), (UNITY_INT)(UNITY_INT16)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16)
-#define UNITY_TEST_ASSERT_EQUAL_INT32(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)(expected), (UNITY_INT)(UNITY_INT32)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32)
-#define UNITY_TEST_ASSERT_EQUAL_UINT(expected, actual, line, message)                            UnityAssertEqualNumber((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT)
-#define UNITY_TEST_ASSERT_EQUAL_UINT8(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )(expected), (UNITY_INT)(UNITY_UINT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8)
-#define UNITY_TEST_ASSERT_EQUAL_UINT16(expected, actual, line, message)                          UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)(expected), (UNITY_INT)(UNITY_UINT16)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16)
-#define UNITY_TEST_ASSERT_EQUAL_UINT32(expected, actual, line, message)                          UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT32)(expected), (UNITY_INT)(UNITY_UINT32)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32)
-#define UNITY_TEST_ASSERT_EQUAL_HEX8(expected, actual, line, message)                            UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8)
-#define UNITY_TEST_ASSERT_EQUAL_HEX16(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)(expected), (UNITY_INT)(UNITY_INT16)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16)
-#define UNITY_TEST_ASSERT_EQUAL_HEX32(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)(expected), (UNITY_INT)(UNITY_INT32)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32)
-#define UNITY_TEST_ASSERT_EQUAL_CHAR(expected, actual, line, message)                            UnityAssertEqualNumber((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR)
+#define UNITY_TEST_ASSERT_EQUAL_INT(expected, actual, line, message)                             UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT)
+#define UNITY_TEST_ASSERT_EQUAL_INT8(expected, actual, line, message)                            UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8)
+#define UNITY_TEST_ASSERT_EQUAL_INT16(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT16)(expected), (UNITY_INT)(UNITY_INT16)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16)
+#define UNITY_TEST_ASSERT_EQUAL_INT32(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT32)(expected), (UNITY_INT)(UNITY_INT32)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32)
+#define UNITY_TEST_ASSERT_EQUAL_UINT(expected, actual, line, message)                            UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT)
+#define UNITY_TEST_ASSERT_EQUAL_UINT8(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_UINT8 )(expected), (UNITY_INT)(UNITY_UINT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8)
+#define UNITY_TEST_ASSERT_EQUAL_UINT16(expected, actual, line, message)                          UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_UINT16)(expected), (UNITY_INT)(UNITY_UINT16)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16)
+#define UNITY_TEST_ASSERT_EQUAL_UINT32(expected, actual, line, message)                          UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_UINT32)(expected), (UNITY_INT)(UNITY_UINT32)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32)
+#define UNITY_TEST_ASSERT_EQUAL_HEX8(expected, actual, line, message)                            UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8)
+#define UNITY_TEST_ASSERT_EQUAL_HEX16(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT16)(expected), (UNITY_INT)(UNITY_INT16)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16)
+#define UNITY_TEST_ASSERT_EQUAL_HEX32(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT32)(expected), (UNITY_INT)(UNITY_INT32)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32)
+#define UNITY_TEST_ASSERT_EQUAL_CHAR(expected, actual, line, message)                            UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(UNITY_INT8 )(expected), (UNITY_INT)(UNITY_INT8 )(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR)
 #define UNITY_TEST_ASSERT_BITS(mask, expected, actual, line, message)                            UnityAssertBits((UNITY_INT)(mask), (UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line))
+#define UNITY_TEST_ASSERT_BITS_ARRAY(mask, expected, actual, num_elements, line, message)        UnityAssertBitsArray((UNITY_INTERNAL_PTR)(mask), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT)
+#define UNITY_TEST_ASSERT_BITS8_ARRAY(mask, expected, actual, num_elements, line, message)       UnityAssertBitsArray((UNITY_INTERNAL_PTR)(mask), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8)
+#define UNITY_TEST_ASSERT_BITS16_ARRAY(mask, expected, actual, num_elements, line, message)      UnityAssertBitsArray((UNITY_INTERNAL_PTR)(mask), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16)
+#define UNITY_TEST_ASSERT_BITS32_ARRAY(mask, expected, actual, num_elements, line, message)      UnityAssertBitsArray((UNITY_INTERNAL_PTR)(mask), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32)
 
 #define UNITY_TEST_ASSERT_GREATER_THAN_INT(threshold, actual, line, message)                     UnityAssertGreaterOrLessOrEqualNumber((UNITY_INT)(threshold),              (UNITY_INT)(actual),              UNITY_GREATER_THAN, (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT)
 #define UNITY_TEST_ASSERT_GREATER_THAN_INT8(threshold, actual, line, message)                    UnityAssertGreaterOrLessOrEqualNumber((UNITY_INT)(UNITY_INT8 )(threshold), (UNITY_INT)(UNITY_INT8 )(actual), UNITY_GREATER_THAN, (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8)
@@ -850,10 +1217,15 @@ int UnityTestMatches(void);
 #define UNITY_TEST_ASSERT_CHAR_ARRAY_WITHIN(delta, expected, actual, num_elements, line, message)    UnityAssertNumbersArrayWithin((UNITY_UINT8 )(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), ((UNITY_UINT32)(num_elements)), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR, UNITY_ARRAY_TO_ARRAY)
 
 
-#define UNITY_TEST_ASSERT_EQUAL_PTR(expected, actual, line, message)                             UnityAssertEqualNumber((UNITY_PTR_TO_INT)(expected), (UNITY_PTR_TO_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_POINTER)
+#define UNITY_TEST_ASSERT_EQUAL_PTR(expected, actual, line, message)                             UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_PTR_TO_INT)(expected), (UNITY_PTR_TO_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_POINTER)
 #define UNITY_TEST_ASSERT_EQUAL_STRING(expected, actual, line, message)                          UnityAssertEqualString((const char*)(expected), (const char*)(actual), (message), (UNITY_LINE_TYPE)(line))
 #define UNITY_TEST_ASSERT_EQUAL_STRING_LEN(expected, actual, len, line, message)                 UnityAssertEqualStringLen((const char*)(expected), (const char*)(actual), (UNITY_UINT32)(len), (message), (UNITY_LINE_TYPE)(line))
+#define UNITY_TEST_ASSERT_STRING_CONTAINS(needle, actual, line, message)                         UnityAssertStringSearch((const char*)(needle), (const char*)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_STRING_CONTAINS)
+#define UNITY_TEST_ASSERT_STRING_STARTS_WITH(prefix, actual, line, message)                      UnityAssertStringSearch((const char*)(prefix), (const char*)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_STRING_STARTS_WITH)
+#define UNITY_TEST_ASSERT_STRING_ENDS_WITH(suffix, actual, line, message)                        UnityAssertStringSearch((const char*)(suffix), (const char*)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_STRING_ENDS_WITH)
+#define UNITY_TEST_ASSERT_STRING_MATCHES_GLOB(pattern, actual, line, message)                    UnityAssertStringSearch((const char*)(pattern), (const char*)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_STRING_MATCHES_GLOB)
 #define UNITY_TEST_ASSERT_EQUAL_MEMORY(expected, actual, len, line, message)                     UnityAssertEqualMemory((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(len), 1, (message), (UNITY_LINE_TYPE)(line), UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_MEMORY_MASKED(expected, actual, mask, len, line, message)        UnityAssertEqualMemoryMasked((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_INTERNAL_PTR)(mask), (UNITY_UINT32)(len), (message), (UNITY_LINE_TYPE)(line))
 
 #define UNITY_TEST_ASSERT_EQUAL_INT_ARRAY(expected, actual, num_elements, line, message)         UnityAssertEqualIntArray((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT,     UNITY_ARRAY_TO_ARRAY)
 #define UNITY_TEST_ASSERT_EQUAL_INT8_ARRAY(expected, actual, num_elements, line, message)        UnityAssertEqualIntArray((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8,    UNITY_ARRAY_TO_ARRAY)
@@ -887,10 +1259,100 @@ int UnityTestMatches(void);
 #define UNITY_TEST_ASSERT_EACH_EQUAL_MEMORY(expected, actual, len, num_elements, line, message)  UnityAssertEqualMemory((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(len), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_ARRAY_TO_VAL)
 #define UNITY_TEST_ASSERT_EACH_EQUAL_CHAR(expected, actual, num_elements, line, message)         UnityAssertEqualIntArray(UnityNumToPtr((UNITY_INT)(UNITY_INT8  )(expected), 1),                              (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR,    UNITY_ARRAY_TO_VAL)
 
+#define UNITY_TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)             UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_INT8_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)            UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_INT16_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)           UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_INT32_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)           UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_UINT_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)            UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_UINT8_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)           UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_UINT16_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)          UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_UINT32_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)          UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)            UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)           UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)           UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_CHAR_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)            UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_INT_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)     UnityAssertNumbersArrayWithinStrided(              (delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_INT8_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)    UnityAssertNumbersArrayWithinStrided((UNITY_UINT8 )(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_INT16_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)   UnityAssertNumbersArrayWithinStrided((UNITY_UINT16)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_INT32_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)   UnityAssertNumbersArrayWithinStrided((UNITY_UINT32)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_UINT_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)    UnityAssertNumbersArrayWithinStrided(              (delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_UINT8_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)   UnityAssertNumbersArrayWithinStrided((UNITY_UINT16)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_UINT16_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)  UnityAssertNumbersArrayWithinStrided((UNITY_UINT16)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_UINT32_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)  UnityAssertNumbersArrayWithinStrided((UNITY_UINT32)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_HEX8_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)    UnityAssertNumbersArrayWithinStrided((UNITY_UINT8 )(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_HEX16_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)   UnityAssertNumbersArrayWithinStrided((UNITY_UINT16)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_HEX32_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)   UnityAssertNumbersArrayWithinStrided((UNITY_UINT32)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_CHAR_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)    UnityAssertNumbersArrayWithinStrided((UNITY_UINT8 )(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_INT_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)                UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT, NULL, 0)
+#define UNITY_TEST_ASSERT_INT8_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)               UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8, NULL, 0)
+#define UNITY_TEST_ASSERT_INT16_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)              UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16, NULL, 0)
+#define UNITY_TEST_ASSERT_INT32_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)              UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32, NULL, 0)
+#define UNITY_TEST_ASSERT_UINT_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)               UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT, NULL, 0)
+#define UNITY_TEST_ASSERT_UINT8_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)              UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8, NULL, 0)
+#define UNITY_TEST_ASSERT_UINT16_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)             UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16, NULL, 0)
+#define UNITY_TEST_ASSERT_UINT32_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)             UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32, NULL, 0)
+#define UNITY_TEST_ASSERT_HEX8_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)               UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8, NULL, 0)
+#define UNITY_TEST_ASSERT_HEX16_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)              UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16, NULL, 0)
+#define UNITY_TEST_ASSERT_HEX32_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)              UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32, NULL, 0)
+#define UNITY_TEST_ASSERT_CHAR_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)               UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR, NULL, 0)
+#define UNITY_TEST_ASSERT_INT_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT, NULL, 0)
+#define UNITY_TEST_ASSERT_INT8_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8, NULL, 0)
+#define UNITY_TEST_ASSERT_INT16_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16, NULL, 0)
+#define UNITY_TEST_ASSERT_INT32_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32, NULL, 0)
+#define UNITY_TEST_ASSERT_UINT_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT, NULL, 0)
+#define UNITY_TEST_ASSERT_UINT8_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8, NULL, 0)
+#define UNITY_TEST_ASSERT_UINT16_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16, NULL, 0)
+#define UNITY_TEST_ASSERT_UINT32_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32, NULL, 0)
+#define UNITY_TEST_ASSERT_HEX8_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8, NULL, 0)
+#define UNITY_TEST_ASSERT_HEX16_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16, NULL, 0)
+#define UNITY_TEST_ASSERT_HEX32_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32, NULL, 0)
+#define UNITY_TEST_ASSERT_CHAR_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR, NULL, 0)
+#define UNITY_TEST_ASSERT_INT_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_INT8_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_INT16_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_INT32_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_UINT_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_UINT8_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_UINT16_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_UINT32_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_HEX8_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_HEX16_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_HEX32_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_CHAR_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_INT_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_INT8_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_INT16_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_INT32_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_UINT_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_UINT8_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_UINT16_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_UINT32_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_HEX8_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_HEX16_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_HEX32_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_CHAR_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_INT_ARRAY_SORTED(actual, num_elements, line, message)                               UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT)
+#define UNITY_TEST_ASSERT_INT8_ARRAY_SORTED(actual, num_elements, line, message)                              UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT8)
+#define UNITY_TEST_ASSERT_INT16_ARRAY_SORTED(actual, num_elements, line, message)                             UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT16)
+#define UNITY_TEST_ASSERT_INT32_ARRAY_SORTED(actual, num_elements, line, message)                             UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT32)
+#define UNITY_TEST_ASSERT_UINT_ARRAY_SORTED(actual, num_elements, line, message)                              UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT)
+#define UNITY_TEST_ASSERT_UINT8_ARRAY_SORTED(actual, num_elements, line, message)                             UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT8)
+#define UNITY_TEST_ASSERT_UINT16_ARRAY_SORTED(actual, num_elements, line, message)                            UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT16)
+#define UNITY_TEST_ASSERT_UINT32_ARRAY_SORTED(actual, num_elements, line, message)                            UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT32)
+#define UNITY_TEST_ASSERT_HEX8_ARRAY_SORTED(actual, num_elements, line, message)                              UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX8)
+#define UNITY_TEST_ASSERT_HEX16_ARRAY_SORTED(actual, num_elements, line, message)                             UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX16)
+#define UNITY_TEST_ASSERT_HEX32_ARRAY_SORTED(actual, num_elements, line, message)                             UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX32)
+#define UNITY_TEST_ASSERT_CHAR_ARRAY_SORTED(actual, num_elements, line, message)                              UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_CHAR)
+#define UNITY_TEST_ASSERT_STRING_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)             UnityAssertStringArrayUnordered((const char**)(expected), (const char**)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), NULL, 0)
+#define UNITY_TEST_ASSERT_STRING_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertStringArrayUnordered((const char**)(expected), (const char**)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), NULL, 0)
+#define UNITY_TEST_ASSERT_STRING_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertStringArrayUnordered((const char**)(expected), (const char**)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_STRING_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertStringArrayUnordered((const char**)(expected), (const char**)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_STRING_ARRAY_SORTED(actual, num_elements, line, message)                            UnityAssertStringArraySorted((const char**)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line))
+
 #ifdef UNITY_SUPPORT_64
-#define UNITY_TEST_ASSERT_EQUAL_INT64(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64)
-#define UNITY_TEST_ASSERT_EQUAL_UINT64(expected, actual, line, message)                          UnityAssertEqualNumber((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64)
-#define UNITY_TEST_ASSERT_EQUAL_HEX64(expected, actual, line, message)                           UnityAssertEqualNumber((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64)
+#define UNITY_TEST_ASSERT_EQUAL_INT64(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64)
+#define UNITY_TEST_ASSERT_EQUAL_UINT64(expected, actual, line, message)                          UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64)
+#define UNITY_TEST_ASSERT_EQUAL_HEX64(expected, actual, line, message)                           UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64)
 #define UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY(expected, actual, num_elements, line, message)       UnityAssertEqualIntArray((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64,  UNITY_ARRAY_TO_ARRAY)
 #define UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY(expected, actual, num_elements, line, message)      UnityAssertEqualIntArray((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64, UNITY_ARRAY_TO_ARRAY)
 #define UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY(expected, actual, num_elements, line, message)       UnityAssertEqualIntArray((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64,  UNITY_ARRAY_TO_ARRAY)
@@ -915,6 +1377,30 @@ int UnityTestMatches(void);
 #define UNITY_TEST_ASSERT_INT64_ARRAY_WITHIN(delta, expected, actual, num_elements, line, message)   UnityAssertNumbersArrayWithin((UNITY_UINT64)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64, UNITY_ARRAY_TO_ARRAY)
 #define UNITY_TEST_ASSERT_UINT64_ARRAY_WITHIN(delta, expected, actual, num_elements, line, message)  UnityAssertNumbersArrayWithin((UNITY_UINT64)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64, UNITY_ARRAY_TO_ARRAY)
 #define UNITY_TEST_ASSERT_HEX64_ARRAY_WITHIN(delta, expected, actual, num_elements, line, message)   UnityAssertNumbersArrayWithin((UNITY_UINT64)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)           UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)          UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)           UnityAssertEqualIntArrayStrided((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_INT64_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)   UnityAssertNumbersArrayWithinStrided((UNITY_UINT64)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)  UnityAssertNumbersArrayWithinStrided((UNITY_UINT64)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)   UnityAssertNumbersArrayWithinStrided((UNITY_UINT64)(delta), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64, UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_MEMORY_HASH(expected, actual, len, line, message)              UnityAssertMemoryHash((UNITY_UINT64)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT)(len), (message), (UNITY_LINE_TYPE)(line))
+#define UNITY_TEST_ASSERT_EQUAL_HASH(expected, state, line, message)                     UnityAssertEqualHash((UNITY_UINT64)(expected), UnityHash_Final(state), (message), (UNITY_LINE_TYPE)(line))
+#define UNITY_TEST_ASSERT_INT64_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)              UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64, NULL, 0)
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)             UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64, NULL, 0)
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)              UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64, NULL, 0)
+#define UNITY_TEST_ASSERT_INT64_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64, NULL, 0)
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64, NULL, 0)
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64, NULL, 0)
+#define UNITY_TEST_ASSERT_INT64_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_INT64_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UnityAssertIntArrayUnordered((UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(expected_elements), (UNITY_UINT32)(actual_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64, (UNITY_ARRAY_SCRATCH_T*)(scratch), (UNITY_UINT32)(scratch_slots))
+#define UNITY_TEST_ASSERT_INT64_ARRAY_SORTED(actual, num_elements, line, message)                             UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_INT64)
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_SORTED(actual, num_elements, line, message)                            UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_UINT64)
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_SORTED(actual, num_elements, line, message)                             UnityAssertIntArraySorted((UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64)
+#define UNITY_TEST_ASSERT_BITS64_ARRAY(mask, expected, actual, num_elements, line, message)                   UnityAssertBitsArray((UNITY_INTERNAL_PTR)(mask), (UNITY_INTERNAL_PTR)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_DISPLAY_STYLE_HEX64)
 #else
 #define UNITY_TEST_ASSERT_EQUAL_INT64(expected, actual, line, message)                           UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
 #define UNITY_TEST_ASSERT_EQUAL_UINT64(expected, actual, line, message)                          UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
@@ -940,12 +1426,80 @@ int UnityTestMatches(void);
 #define UNITY_TEST_ASSERT_INT64_ARRAY_WITHIN(delta, expected, actual, num_elements, line, message)   UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
 #define UNITY_TEST_ASSERT_UINT64_ARRAY_WITHIN(delta, expected, actual, num_elements, line, message)  UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
 #define UNITY_TEST_ASSERT_HEX64_ARRAY_WITHIN(delta, expected, actual, num_elements, line, message)   UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EQUAL_INT64_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)           UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EQUAL_UINT64_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)          UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EQUAL_HEX64_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)           UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_INT64_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)   UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)  UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_WITHIN_STRIDED(delta, expected, actual, stride, offset, num_elements, line, message)   UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_MEMORY_HASH(expected, actual, len, line, message)              UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_EQUAL_HASH(expected, state, line, message)                     UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_INT64_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)              UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)             UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_PERMUTATION(expected, actual, num_elements, line, message)              UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_INT64_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_SUBSET(expected, actual, expected_elements, actual_elements, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_INT64_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_PERMUTATION_WITH_SCRATCH(expected, actual, num_elements, scratch, scratch_slots, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_INT64_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_SUBSET_WITH_SCRATCH(expected, actual, expected_elements, actual_elements, scratch, scratch_slots, line, message) UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_INT64_ARRAY_SORTED(actual, num_elements, line, message)                             UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_UINT64_ARRAY_SORTED(actual, num_elements, line, message)                            UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_HEX64_ARRAY_SORTED(actual, num_elements, line, message)                             UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#define UNITY_TEST_ASSERT_BITS64_ARRAY(mask, expected, actual, num_elements, line, message)                   UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64)
+#endif
+
+/* TEST_ASSERT_EQ picks the width and display style from the type of actual at
+ * compile time. Types wider than UNITY_INT fail unless 64-bit support is on. */
+#ifdef __STDC_VERSION__
+#if __STDC_VERSION__ >= 201112L
+#define UNITY_SUPPORT_GENERIC
+#endif
+#endif
+
+#ifdef UNITY_SUPPORT_GENERIC
+#define UNITY_GENERIC_STYLE(x) ((UNITY_DISPLAY_STYLE_T)_Generic((x), \
+    _Bool:              UNITY_DISPLAY_STYLE_UINT8, \
+    char:               UNITY_DISPLAY_STYLE_CHAR, \
+    signed char:        UNITY_DISPLAY_STYLE_INT8, \
+    unsigned char:      UNITY_DISPLAY_STYLE_UINT8, \
+    short:              UNITY_DISPLAY_STYLE_INT16, \
+    unsigned short:     UNITY_DISPLAY_STYLE_UINT16, \
+    int:                UNITY_DISPLAY_STYLE_INT, \
+    unsigned int:       UNITY_DISPLAY_STYLE_UINT, \
+    long:               (UNITY_LONG_WIDTH / 8) + UNITY_DISPLAY_RANGE_INT, \
+    unsigned long:      (UNITY_LONG_WIDTH / 8) + UNITY_DISPLAY_RANGE_UINT, \
+    long long:          8 + UNITY_DISPLAY_RANGE_INT, \
+    unsigned long long: 8 + UNITY_DISPLAY_RANGE_UINT))
+#define UNITY_TEST_ASSERT_EQ(expected, actual, line, message) \
+    do { \
+        if (sizeof(actual) > sizeof(UNITY_INT)) \
+        { \
+            UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErr64); \
+        } \
+        else \
+        { \
+            UNITY_TEST_ASSERT_EQUAL_NUMBER((UNITY_INT)(expected), (UNITY_INT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_GENERIC_STYLE(actual)); \
+        } \
+    } while (0)
+#else
+#define UNITY_TEST_ASSERT_EQ(expected, actual, line, message)                                    UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrGeneric)
+#endif
+
+#ifdef UNITY_INCLUDE_GOLDEN_FILE
+#define UNITY_TEST_ASSERT_MATCHES_GOLDEN_FILE(path, actual, len, line, message)          UnityAssertMatchesGoldenFile((path), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT)(len), (message), (UNITY_LINE_TYPE)(line))
+#else
+#define UNITY_TEST_ASSERT_MATCHES_GOLDEN_FILE(path, actual, len, line, message)          UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrGoldenFile)
 #endif
 
 #ifdef UNITY_EXCLUDE_FLOAT
 #define UNITY_TEST_ASSERT_FLOAT_WITHIN(delta, expected, actual, line, message)                   UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
 #define UNITY_TEST_ASSERT_EQUAL_FLOAT(expected, actual, line, message)                           UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
 #define UNITY_TEST_ASSERT_EQUAL_FLOAT_ARRAY(expected, actual, num_elements, line, message)       UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
+#define UNITY_TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)           UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
 #define UNITY_TEST_ASSERT_EACH_EQUAL_FLOAT(expected, actual, num_elements, line, message)        UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
 #define UNITY_TEST_ASSERT_FLOAT_IS_INF(actual, line, message)                                    UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
 #define UNITY_TEST_ASSERT_FLOAT_IS_NEG_INF(actual, line, message)                                UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrFloat)
@@ -959,6 +1513,7 @@ int UnityTestMatches(void);
 #define UNITY_TEST_ASSERT_FLOAT_WITHIN(delta, expected, actual, line, message)                   UnityAssertFloatsWithin((UNITY_FLOAT)(delta), (UNITY_FLOAT)(expected), (UNITY_FLOAT)(actual), (message), (UNITY_LINE_TYPE)(line))
 #define UNITY_TEST_ASSERT_EQUAL_FLOAT(expected, actual, line, message)                           UNITY_TEST_ASSERT_FLOAT_WITHIN((UNITY_FLOAT)(expected) * (UNITY_FLOAT)UNITY_FLOAT_PRECISION, (UNITY_FLOAT)(expected), (UNITY_FLOAT)(actual), (UNITY_LINE_TYPE)(line), (message))
 #define UNITY_TEST_ASSERT_EQUAL_FLOAT_ARRAY(expected, actual, num_elements, line, message)       UnityAssertEqualFloatArray((UNITY_FLOAT*)(expected), (UNITY_FLOAT*)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)           UnityAssertEqualFloatArrayStrided((UNITY_FLOAT*)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_ARRAY_TO_ARRAY)
 #define UNITY_TEST_ASSERT_EACH_EQUAL_FLOAT(expected, actual, num_elements, line, message)        UnityAssertEqualFloatArray(UnityFloatToPtr(expected), (UNITY_FLOAT*)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_ARRAY_TO_VAL)
 #define UNITY_TEST_ASSERT_FLOAT_IS_INF(actual, line, message)                                    UnityAssertFloatSpecial((UNITY_FLOAT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_FLOAT_IS_INF)
 #define UNITY_TEST_ASSERT_FLOAT_IS_NEG_INF(actual, line, message)                                UnityAssertFloatSpecial((UNITY_FLOAT)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_FLOAT_IS_NEG_INF)
@@ -974,6 +1529,7 @@ int UnityTestMatches(void);
 #define UNITY_TEST_ASSERT_DOUBLE_WITHIN(delta, expected, actual, line, message)                  UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
 #define UNITY_TEST_ASSERT_EQUAL_DOUBLE(expected, actual, line, message)                          UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
 #define UNITY_TEST_ASSERT_EQUAL_DOUBLE_ARRAY(expected, actual, num_elements, line, message)      UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
+#define UNITY_TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)          UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
 #define UNITY_TEST_ASSERT_EACH_EQUAL_DOUBLE(expected, actual, num_elements, line, message)       UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
 #define UNITY_TEST_ASSERT_DOUBLE_IS_INF(actual, line, message)                                   UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
 #define UNITY_TEST_ASSERT_DOUBLE_IS_NEG_INF(actual, line, message)                               UNITY_TEST_FAIL((UNITY_LINE_TYPE)(line), UnityStrErrDouble)
@@ -987,6 +1543,7 @@ int UnityTestMatches(void);
 #define UNITY_TEST_ASSERT_DOUBLE_WITHIN(delta, expected, actual, line, message)                  UnityAssertDoublesWithin((UNITY_DOUBLE)(delta), (UNITY_DOUBLE)(expected), (UNITY_DOUBLE)(actual), (message), (UNITY_LINE_TYPE)(line))
 #define UNITY_TEST_ASSERT_EQUAL_DOUBLE(expected, actual, line, message)                          UNITY_TEST_ASSERT_DOUBLE_WITHIN((UNITY_DOUBLE)(expected) * (UNITY_DOUBLE)UNITY_DOUBLE_PRECISION, (UNITY_DOUBLE)(expected), (UNITY_DOUBLE)(actual), (UNITY_LINE_TYPE)(line), (message))
 #define UNITY_TEST_ASSERT_EQUAL_DOUBLE_ARRAY(expected, actual, num_elements, line, message)      UnityAssertEqualDoubleArray((UNITY_DOUBLE*)(expected), (UNITY_DOUBLE*)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_ARRAY_TO_ARRAY)
+#define UNITY_TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED(expected, actual, stride, offset, num_elements, line, message)          UnityAssertEqualDoubleArrayStrided((UNITY_DOUBLE*)(expected), (UNITY_INTERNAL_PTR)(actual), (UNITY_UINT32)(num_elements), (UNITY_UINT32)(stride), (UNITY_UINT32)(offset), (message), (UNITY_LINE_TYPE)(line), UNITY_ARRAY_TO_ARRAY)
 #define UNITY_TEST_ASSERT_EACH_EQUAL_DOUBLE(expected, actual, num_elements, line, message)       UnityAssertEqualDoubleArray(UnityDoubleToPtr(expected), (UNITY_DOUBLE*)(actual), (UNITY_UINT32)(num_elements), (message), (UNITY_LINE_TYPE)(line), UNITY_ARRAY_TO_VAL)
 #define UNITY_TEST_ASSERT_DOUBLE_IS_INF(actual, line, message)                                   UnityAssertDoubleSpecial((UNITY_DOUBLE)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_FLOAT_IS_INF)
 #define UNITY_TEST_ASSERT_DOUBLE_IS_NEG_INF(actual, line, message)                               UnityAssertDoubleSpecial((UNITY_DOUBLE)(actual), (message), (UNITY_LINE_TYPE)(line), UNITY_FLOAT_IS_NEG_INF)
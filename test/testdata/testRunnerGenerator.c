@@ -63,6 +63,7 @@ void test_ThisTestAlwaysPasses(void)
     TEST_PASS();
 }
 
+TEST_TAGS("broken")
 void test_ThisTestAlwaysFails(void)
 {
     TEST_FAIL_MESSAGE("This Test Should Fail");
@@ -115,6 +116,7 @@ void custtest_ThisTestPassesWhenCustomTeardownRan(void)
 //}
 #endif
 
+TEST_TAGS("strings, slow")
 void test_NotBeConfusedByLongComplicatedStrings(void)
 {
     const char* crazyString = "GET / HTTP/1.1\r\nHost: 127.0.0.1:8081\r\nConnection: keep-alive\r\nCache-Control: no-cache\r\nUser-Agent: Mozilla/5.0 (Windows NT 6.3; WOW64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/46.0.2490.80 Safari/537.36\r\nPostman-Token: 768c7149-c3fb-f704-71a2-63918d9195b2\r\nAccept: */*\r\nAccept-Encoding: gzip, deflate, sdch\r\nAccept-Language: en-GB,en-US;q=0.8,en;q=0.6\r\n\r\n";
@@ -130,6 +132,7 @@ void test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings(void)
 }
 /* nor should this */
 
+TEST_TAGS("strings")
 void test_StillNotBeConfusedByLongComplicatedStrings(void)
 {
     const char* crazyString = "GET / HTTP/1.1\r\nHost: 127.0.0.1:8081\r\nConnection: keep-alive\r\nCache-Control: no-cache\r\nUser-Agent: Mozilla/5.0 (Windows NT 6.3; WOW64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/46.0.2490.80 Safari/537.36\r\nPostman-Token: 768c7149-c3fb-f704-71a2-63918d9195b2\r\nAccept: */*\r\nAccept-Encoding: gzip, deflate, sdch\r\nAccept-Language: en-GB,en-US;q=0.8,en;q=0.6\r\n\r\n";
@@ -150,6 +153,7 @@ void paratest_ShouldHandleParameterizedTests(int Num)
     TEST_ASSERT_EQUAL_MESSAGE(0, (Num % 5), "All The Values Are Divisible By 5");
 }
 
+TEST_TAGS("params")
 TEST_CASE(7)
 void paratest_ShouldHandleParameterizedTests2(int Num)
 {
@@ -0,0 +1,37 @@
+/* This Test File Is Built Into One Runner With testRunnerGeneratorSmall.c, To Verify Aggregate Runners */
+
+#include "unity.h"
+
+/* The other file of the runner has these functions too, but this file's own are run */
+static int SetUpRan = 0;
+static int TearDownRan = 0;
+
+void setUp(void)
+{
+    SetUpRan = 1;
+}
+
+void tearDown(void)
+{
+    TearDownRan = 1;
+}
+
+void test_ThisTestAlwaysPasses(void)
+{
+    TEST_PASS();
+}
+
+void test_ThisTestAlwaysFails(void)
+{
+    TEST_FAIL_MESSAGE("This Test Should Fail");
+}
+
+void test_OwnSetUpRan(void)
+{
+    TEST_ASSERT_EQUAL_MESSAGE(1, SetUpRan, "Own Setup Was Not Run");
+}
+
+void test_OwnTearDownRan(void)
+{
+    TEST_ASSERT_EQUAL_MESSAGE(1, TearDownRan, "Own Teardown Was Not Run");
+}
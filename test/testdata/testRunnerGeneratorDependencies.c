@@ -0,0 +1,72 @@
+/* This Test File Is Used To Verify Test Dependencies With the Generate Test Runner Script */
+
+#include <stdio.h>
+#include "unity.h"
+#include "Defs.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+/* Global Variables Used During These Tests */
+int Initialized = 0;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+TEST_DEPENDS_ON(test_InitSucceeds)
+void test_UsesWhatInitSetUp(void)
+{
+    TEST_ASSERT_EQUAL_MESSAGE(1, Initialized, "Ran Before Its Prerequisite");
+}
+
+void test_InitSucceeds(void)
+{
+    Initialized = 1;
+}
+
+void test_ConnectFails(void)
+{
+    TEST_FAIL_MESSAGE("This Test Should Fail");
+}
+
+TEST_DEPENDS_ON(test_ConnectFails)
+void test_SendIsSkippedWhenConnectFails(void)
+{
+    TEST_FAIL_MESSAGE("This Test Should Have Been Skipped");
+}
+
+TEST_DEPENDS_ON(test_SendIsSkippedWhenConnectFails)
+void test_ReceiveIsSkippedWhenSendIsSkipped(void)
+{
+    TEST_FAIL_MESSAGE("This Test Should Have Been Skipped");
+}
+
+TEST_DEPENDS_ON("test_InitSucceeds, test_UsesWhatInitSetUp")
+void test_RunsWhenAllItsPrerequisitesPass(void)
+{
+    TEST_ASSERT_EQUAL(1, Initialized);
+}
+
+#ifdef USE_ANOTHER_MAIN
+int custom_main(int argc, char** argv);
+
+/* Runs the tests twice in one process, as a host does, the second time without
+ * the prerequisite that failed the first time */
+int main(int argc, char** argv)
+{
+    char name_filter[] = "-n";
+    char send_only[] = "test_SendIsSkippedWhenConnectFails";
+    char* again[3];
+
+    again[0] = argv[0];
+    again[1] = name_filter;
+    again[2] = send_only;
+    return custom_main(argc, argv) + custom_main(3, again);
+}
+#endif
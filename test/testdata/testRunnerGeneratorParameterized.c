@@ -0,0 +1,109 @@
+/* This Test File Is Used To Verify The Cases The Generate Test Runner Script Makes For Parameterized Tests */
+
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+
+/* Support for Meta Test Rig */
+#define TEST_CASE(...)
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+TEST_CASE(3, "abc")
+TEST_CASE(0, "")
+void test_CasesPassEveryArgument(int length, const char* str)
+{
+    TEST_ASSERT_EQUAL_INT(length, (int)strlen(str));
+}
+
+TEST_RANGE(0, 20, 5)
+void test_RangeRunsEveryStepIncludingTheEnd(int value)
+{
+    TEST_ASSERT_EQUAL_INT(0, value % 5);
+    TEST_ASSERT_TRUE(value <= 20);
+}
+
+TEST_RANGE([1, 3, 1], [30, 10, -10])
+void test_RangesForEachArgumentCombine(int ones, int tens)
+{
+    TEST_ASSERT_TRUE((ones >= 1) && (ones <= 3));
+    TEST_ASSERT_EQUAL_INT(0, tens % 10);
+}
+
+TEST_RANGE(0.5, 1.5, 0.5)
+void test_RangeTakesFloatingPointSteps(double value)
+{
+    TEST_ASSERT_TRUE((value > 0.25) && (value < 1.75));
+}
+
+TEST_MATRIX([1, 2], [1, -1])
+void test_MatrixRunsEveryCombination(int a, int b)
+{
+    TEST_ASSERT_TRUE_MESSAGE(a * b > 0, "Only The Negative Combinations Fail");
+}
+
+TEST_CASE(1, "a,b")
+TEST_MATRIX([2], ["c)", "d]"])
+void test_ListsSplitOnlyBetweenArguments(int count, const char* str)
+{
+    TEST_ASSERT_EQUAL_INT(4, (int)strlen(str) + count);
+}
+
+TEST_CASE("abc")
+void test_ArrayParametersStillGetWrappers(const char str[])
+{
+    TEST_ASSERT_EQUAL_STRING("abc", str);
+}
+
+TEST_CASE((int)strlen("abcdefg"))
+TEST_CASE((int)strlen("abcdefg") + 1)
+void test_CasesMayCallFunctions(int value)
+{
+    TEST_ASSERT_TRUE((value == 7) || (value == 8));
+}
+
+/* Cases made at run time, named by the provider or else by their index */
+static const char* const ColorNames[] = { "red", "green", "blue" };
+
+int colors(UNITY_TEST_CASE_T* test_case)
+{
+    if (test_case->Index >= 3)
+        return 0;
+    strcpy(test_case->Name, ColorNames[test_case->Index]);
+    test_case->Data = &ColorNames[test_case->Index];
+    return 1;
+}
+
+TEST_CASE_SOURCE(colors)
+void test_SourceRunsEveryCaseItMakes(const UNITY_TEST_CASE_T* test_case)
+{
+    TEST_ASSERT_EQUAL_STRING(ColorNames[test_case->Index], *(const char* const*)test_case->Data);
+    TEST_ASSERT_TRUE_MESSAGE(test_case->Index != 2, "Only Blue Fails");
+}
+
+int squares(UNITY_TEST_CASE_T* test_case)
+{
+    static int square;
+
+    if (test_case->Index >= 4)
+        return 0;
+    square = (int)(test_case->Index * test_case->Index);
+    test_case->Data = &square;
+    return 1;
+}
+
+TEST_CASE_SOURCE(squares)
+void test_SourceCasesWithoutANameGoByIndex(const UNITY_TEST_CASE_T* test_case)
+{
+    TEST_ASSERT_EQUAL_INT((int)(test_case->Index * test_case->Index), *(const int*)test_case->Data);
+}
@@ -194,6 +194,146 @@ RUNNER_TESTS = [
     }
   },
 
+  { :name => 'ParameterizedRangesAndMatrices',
+    :testfile => 'testdata/testRunnerGeneratorParameterized.c',
+    :testdefines => ['TEST'],
+    :options => {
+      :use_param_tests => true,
+    },
+    :features => [ :parameterized ],
+    :expected => {
+      :to_pass => [ 'test_CasesPassEveryArgument\(3, "abc"\)',
+                    'test_CasesPassEveryArgument\(0, ""\)',
+                    'test_RangeRunsEveryStepIncludingTheEnd\(0\)',
+                    'test_RangeRunsEveryStepIncludingTheEnd\(5\)',
+                    'test_RangeRunsEveryStepIncludingTheEnd\(10\)',
+                    'test_RangeRunsEveryStepIncludingTheEnd\(15\)',
+                    'test_RangeRunsEveryStepIncludingTheEnd\(20\)',
+                    'test_RangesForEachArgumentCombine\(1, 30\)',
+                    'test_RangesForEachArgumentCombine\(1, 20\)',
+                    'test_RangesForEachArgumentCombine\(1, 10\)',
+                    'test_RangesForEachArgumentCombine\(2, 30\)',
+                    'test_RangesForEachArgumentCombine\(2, 20\)',
+                    'test_RangesForEachArgumentCombine\(2, 10\)',
+                    'test_RangesForEachArgumentCombine\(3, 30\)',
+                    'test_RangesForEachArgumentCombine\(3, 20\)',
+                    'test_RangesForEachArgumentCombine\(3, 10\)',
+                    'test_RangeTakesFloatingPointSteps\(0.5\)',
+                    'test_RangeTakesFloatingPointSteps\(1.0\)',
+                    'test_RangeTakesFloatingPointSteps\(1.5\)',
+                    'test_MatrixRunsEveryCombination\(1, 1\)',
+                    'test_MatrixRunsEveryCombination\(2, 1\)',
+                    'test_ListsSplitOnlyBetweenArguments\(1, "a,b"\)',
+                    'test_ListsSplitOnlyBetweenArguments\(2, "c\)"\)',
+                    'test_ListsSplitOnlyBetweenArguments\(2, "d\]"\)',
+                    'test_ArrayParametersStillGetWrappers\("abc"\)',
+                    'test_CasesMayCallFunctions\(\(int\)strlen\("abcdefg"\)\)',
+                    'test_CasesMayCallFunctions\(\(int\)strlen\("abcdefg"\) \+ 1\)',
+                    'test_SourceRunsEveryCaseItMakes\(red\)',
+                    'test_SourceRunsEveryCaseItMakes\(green\)',
+                    'test_SourceCasesWithoutANameGoByIndex\(0\)',
+                    'test_SourceCasesWithoutANameGoByIndex\(1\)',
+                    'test_SourceCasesWithoutANameGoByIndex\(2\)',
+                    'test_SourceCasesWithoutANameGoByIndex\(3\)',
+                  ],
+      :to_fail => [ 'test_MatrixRunsEveryCombination\(1, -1\)',
+                    'test_MatrixRunsEveryCombination\(2, -1\)',
+                    'test_SourceRunsEveryCaseItMakes\(blue\)',
+                  ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ParameterizedRangesAndMatricesFromTables',
+    :testfile => 'testdata/testRunnerGeneratorParameterized.c',
+    :testdefines => ['TEST'],
+    :options => {
+      :use_param_tests => true,
+      :param_tables => true,
+    },
+    :features => [ :parameterized ],
+    :expected => {
+      :to_pass => [ 'test_CasesPassEveryArgument\(3, "abc"\)',
+                    'test_CasesPassEveryArgument\(0, ""\)',
+                    'test_RangeRunsEveryStepIncludingTheEnd\(0\)',
+                    'test_RangeRunsEveryStepIncludingTheEnd\(5\)',
+                    'test_RangeRunsEveryStepIncludingTheEnd\(10\)',
+                    'test_RangeRunsEveryStepIncludingTheEnd\(15\)',
+                    'test_RangeRunsEveryStepIncludingTheEnd\(20\)',
+                    'test_RangesForEachArgumentCombine\(1, 30\)',
+                    'test_RangesForEachArgumentCombine\(1, 20\)',
+                    'test_RangesForEachArgumentCombine\(1, 10\)',
+                    'test_RangesForEachArgumentCombine\(2, 30\)',
+                    'test_RangesForEachArgumentCombine\(2, 20\)',
+                    'test_RangesForEachArgumentCombine\(2, 10\)',
+                    'test_RangesForEachArgumentCombine\(3, 30\)',
+                    'test_RangesForEachArgumentCombine\(3, 20\)',
+                    'test_RangesForEachArgumentCombine\(3, 10\)',
+                    'test_RangeTakesFloatingPointSteps\(0.5\)',
+                    'test_RangeTakesFloatingPointSteps\(1.0\)',
+                    'test_RangeTakesFloatingPointSteps\(1.5\)',
+                    'test_MatrixRunsEveryCombination\(1, 1\)',
+                    'test_MatrixRunsEveryCombination\(2, 1\)',
+                    'test_ListsSplitOnlyBetweenArguments\(1, "a,b"\)',
+                    'test_ListsSplitOnlyBetweenArguments\(2, "c\)"\)',
+                    'test_ListsSplitOnlyBetweenArguments\(2, "d\]"\)',
+                    'test_ArrayParametersStillGetWrappers\("abc"\)',
+                    'test_CasesMayCallFunctions\(\(int\)strlen\("abcdefg"\)\)',
+                    'test_CasesMayCallFunctions\(\(int\)strlen\("abcdefg"\) \+ 1\)',
+                    'test_SourceRunsEveryCaseItMakes\(red\)',
+                    'test_SourceRunsEveryCaseItMakes\(green\)',
+                    'test_SourceCasesWithoutANameGoByIndex\(0\)',
+                    'test_SourceCasesWithoutANameGoByIndex\(1\)',
+                    'test_SourceCasesWithoutANameGoByIndex\(2\)',
+                    'test_SourceCasesWithoutANameGoByIndex\(3\)',
+                  ],
+      :to_fail => [ 'test_MatrixRunsEveryCombination\(1, -1\)',
+                    'test_MatrixRunsEveryCombination\(2, -1\)',
+                    'test_SourceRunsEveryCaseItMakes\(blue\)',
+                  ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ParameterizedRangesAndMatricesFilteredByName',
+    :testfile => 'testdata/testRunnerGeneratorParameterized.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :use_param_tests => true,
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-n test_MatrixRunsEveryCombination",
+    :features => [ :parameterized ],
+    :expected => {
+      :to_pass => [ 'test_MatrixRunsEveryCombination\(1, 1\)',
+                    'test_MatrixRunsEveryCombination\(2, 1\)',
+                  ],
+      :to_fail => [ 'test_MatrixRunsEveryCombination\(1, -1\)',
+                    'test_MatrixRunsEveryCombination\(2, -1\)',
+                  ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ParameterizedCaseSourcesAreShardedByCase',
+    :testfile => 'testdata/testRunnerGeneratorParameterized.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :use_param_tests => true,
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-n test_Source* --shard=1/2",
+    :features => [ :parameterized ],
+    :expected => {
+      :to_pass => [ 'test_SourceRunsEveryCaseItMakes\(red\)',
+                    'test_SourceCasesWithoutANameGoByIndex\(1\)',
+                    'test_SourceCasesWithoutANameGoByIndex\(3\)',
+                  ],
+      :to_fail => [ 'test_SourceRunsEveryCaseItMakes\(blue\)' ],
+      :to_ignore => [ ],
+    }
+  },
+
   { :name => 'CException',
     :testfile => 'testdata/testRunnerGenerator.c',
     :testdefines => ['TEST', 'USE_CEXCEPTION'],
@@ -1062,154 +1202,850 @@ RUNNER_TESTS = [
     }
   },
 
-  { :name => 'ArgsList',
+  { :name => 'ArgsIncludeRepeatedFlags',
     :testfile => 'testdata/testRunnerGenerator.c',
     :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
     :options => {
       :cmdline_args => true,
     },
-    :cmdline_args => "-l",
+    :cmdline_args => "-n ThisTestAlwaysPasses -n should_",
     :expected => {
-      :to_pass => [ ],
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'should_RunTestsStartingWithShouldByDefault',
+                  ],
       :to_fail => [ ],
       :to_ignore => [ ],
-      :text => [  "testRunnerGenerator",
-                  "test_ThisTestAlwaysPasses",
-                  "test_ThisTestAlwaysFails",
-                  "test_ThisTestAlwaysIgnored",
-                  "spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan",
-                  "spec_ThisTestPassesWhenNormalSetupRan",
-                  "spec_ThisTestPassesWhenNormalTeardownRan",
-                  "test_NotBeConfusedByLongComplicatedStrings",
-                  "test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings",
-                  "test_StillNotBeConfusedByLongComplicatedStrings",
-                  "should_RunTestsStartingWithShouldByDefault"
-               ]
     }
   },
 
-  { :name => 'ArgsListParameterized',
+  { :name => 'ArgsIncludeSingleCharacterWildcard',
     :testfile => 'testdata/testRunnerGenerator.c',
     :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
     :options => {
-      :test_prefix => "paratest",
-      :use_param_tests => true,
       :cmdline_args => true,
     },
-    :cmdline_args => "-l",
-    :features => [ :parameterized ],
+    :cmdline_args => "-n :test_ThisTestAlways?a*",
     :expected => {
-      :to_pass => [ ],
-      :to_fail => [ ],
+      :to_pass => [ 'test_ThisTestAlwaysPasses' ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
       :to_ignore => [ ],
-      :text => [  "testRunnerGenerator",
-                  'paratest_ShouldHandleParameterizedTests\(25\)',
-                  'paratest_ShouldHandleParameterizedTests\(125\)',
-                  'paratest_ShouldHandleParameterizedTests\(5\)',
-                  'paratest_ShouldHandleParameterizedTests2\(7\)',
-                  'paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid',
-                  'paratest_ShouldHandleParameterizedTestsThatFail\(17\)'
-               ],
     }
   },
 
-  { :name => 'ArgsIncompleteIncludeFlags',
+  { :name => 'ArgsExcludeRepeatedFlags',
     :testfile => 'testdata/testRunnerGenerator.c',
     :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
     :options => {
       :cmdline_args => true,
     },
-    :cmdline_args => "-n",
+    :cmdline_args => "-x test_ -x spec_",
     :expected => {
-      :to_pass => [ ],
+      :to_pass => [ 'should_RunTestsStartingWithShouldByDefault' ],
       :to_fail => [ ],
       :to_ignore => [ ],
-      :text => [ "ERROR: No Test String to Include Matches For" ],
     }
   },
 
-  { :name => 'ArgsIncompleteExcludeFlags',
+  { :name => 'ArgsIncludeFromFilterFile',
     :testfile => 'testdata/testRunnerGenerator.c',
-    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_FILTER_FILE'],
     :options => {
       :cmdline_args => true,
     },
-    :cmdline_args => "-x",
+    :cmdline_args => "-n @testdata/testRunnerGeneratorFilter.txt",
     :expected => {
-      :to_pass => [ ],
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'should_RunTestsStartingWithShouldByDefault',
+                  ],
       :to_fail => [ ],
       :to_ignore => [ ],
-      :text => [ "ERROR: No Test String to Exclude Matches For" ],
     }
   },
 
-  { :name => 'ArgsIllegalFlags',
+  { :name => 'ArgsExcludeFromFilterFile',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_FILTER_FILE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-n test_ -x @testdata/testRunnerGeneratorFilter.txt",
+    :expected => {
+      :to_pass => [ 'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'ArgsFirstOfThreeShards',
     :testfile => 'testdata/testRunnerGenerator.c',
     :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
     :options => {
       :cmdline_args => true,
     },
-    :cmdline_args => "-z",
+    :cmdline_args => "--shard=1/3",
     :expected => {
-      :to_pass => [ ],
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                    'test_NotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                  ],
       :to_fail => [ ],
       :to_ignore => [ ],
-      :text => [ "ERROR: Unknown Option z" ],
     }
   },
-]
-
-def runner_test(test, runner, expected, test_defines, cmdline_args, features)
-  # Tack on TEST define for compiling unit tests
-  load_configuration($cfg_file)
 
-  # Drop Out if we're skipping this type of test
-  if $cfg[:skip_tests] && features
-    if $cfg[:skip_tests].include?(:parameterized) && features.include?(:parameterized)
-      report("Skipping Parameterized Tests for this Target:IGNORE")
-      return true
-    end
-  end
+  { :name => 'ArgsSecondOfThreeShards',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--shard=2/3",
+    :expected => {
+      :to_pass => [ 'spec_ThisTestPassesWhenNormalSetupRan',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ ],
+    }
+  },
 
-  #compile objects
-  obj_list = [
-    compile(runner, test_defines),
-    compile(test, test_defines),
-    compile('../src/unity.c', test_defines),
-  ]
+  { :name => 'ArgsThirdOfThreeShards',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--shard=3/3",
+    :expected => {
+      :to_pass => [ 'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                  ],
+      :to_fail => [ ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
 
-  # Link the test executable
-  test_base = File.basename(test, C_EXTENSION)
-  link_it(test_base, obj_list)
+  { :name => 'ArgsShardAfterNameFilter',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-n test_ --shard=2/2",
+    :expected => {
+      :to_pass => [ 'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ ],
+    }
+  },
 
-  # Execute unit test and generate results file
-  simulator = build_simulator_fields
-  cmdline_args ||= ""
-  executable = $cfg['linker']['bin_files']['destination'] + test_base + $cfg['linker']['bin_files']['extension'] + " #{cmdline_args}"
-  cmd_str = if simulator.nil?
-              executable
-            else
-              "#{simulator[:command]} #{simulator[:pre_support]} #{executable} #{simulator[:post_support]}"
-            end
-  output = execute(cmd_str, true)
+  { :name => 'ArgsFirstShardPlannedFromTimingHistory',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--shard=1/2 --timing-history=testdata/testRunnerGeneratorTimes.txt",
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ ],
+    }
+  },
 
-  #compare to the expected pass/fail
-  allgood = expected[:to_pass].inject(true)      {|s,v| s && verify_match(/#{v}:PASS/,   output) }
-  allgood = expected[:to_fail].inject(allgood)   {|s,v| s && verify_match(/#{v}:FAIL/,   output) }
-  allgood = expected[:to_ignore].inject(allgood) {|s,v| s && verify_match(/#{v}:IGNORE/, output) }
+  { :name => 'ArgsSecondShardPlannedFromTimingHistory',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--shard=2/2 --timing-history=testdata/testRunnerGeneratorTimes.txt",
+    :expected => {
+      :to_pass => [ 'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'should_RunTestsStartingWithShouldByDefault',
+                  ],
+      :to_fail => [ ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
 
-  #verify there weren't more pass/fail/etc than expected
-  allgood &&= verify_number( expected[:to_pass],   /(:PASS)/,   output)
-  allgood &&= verify_number( expected[:to_fail],   /(:FAIL)/,   output)
-  allgood &&= verify_number( expected[:to_ignore], /(:IGNORE)/, output)
+  { :name => 'ArgsRecordRunState',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
 
-  #if we care about any other text, check that too
-  if (expected[:text])
-    allgood = expected[:text].inject(allgood) {|s,v| s && verify_match(/#{v}/, output) }
-    allgood &&= verify_number( expected[:text], /.+/, output )
-  end
+  { :name => 'ArgsRerunFailed',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--rerun-failed",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ ],
+    }
+  },
 
-  report output if (!allgood && !$verbose) #report failures if not already reporting everything
+  { :name => 'ArgsRerunFailedAgain',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--rerun-failed -x Fails",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsNameFilterKeepsRunStateOfOtherTests',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-n test_ThisTestAlwaysPasses",
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses' ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsRerunFailedAfterNameFilter',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--rerun-failed",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsShardKeepsItsOwnRunState',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--shard=2/3 --rerun-failed",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "ERROR: No Previous Run State In .*shard2of3\\.last_run" ],
+    }
+  },
+
+  { :name => 'ArgsFailFast',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--fail-fast",
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses' ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsFailFastAfterTwoFailures',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--fail-fast=2",
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'ArgsRecordRunStateForFailFirst',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'ArgsFailFirstWithFailFast',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--fail-first --fail-fast",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsRerunFailedAfterFailFast',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--rerun-failed",
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'ArgsTimeBudgetSkipsWhatNoLongerFits',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--time-budget=0.08 --timing-history=testdata/testRunnerGeneratorTimes.txt",
+    :expected => {
+      :to_pass => [ 'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'ArgsRerunFailedAfterTimeBudget',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--rerun-failed",
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsTimeBudgetAddsUpTimesWithoutATimer',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--time-budget=0.1 --timing-history=testdata/testRunnerGeneratorTimes.txt",
+    :expected => {
+      :to_pass => [ 'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'ArgsInvalidTimeBudget',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--time-budget=0",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "ERROR: --time-budget Must Be A Positive Number Of Seconds" ],
+    }
+  },
+
+  { :name => 'ArgsIncludeTags',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--tags=+strings,broken",
+    :expected => {
+      :to_pass => [ 'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsExcludeTags',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--tags=-broken,-slow",
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                  ],
+      :to_fail => [ ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'ArgsTagsCombineWithNameFilters',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--tags=strings,-slow -n Still,Always",
+    :expected => {
+      :to_pass => [ 'test_StillNotBeConfusedByLongComplicatedStrings' ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsUnknownTagSelectsNothing',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--tags=nightly",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'DependentTestsRunAfterOrSkipWithTheirPrerequisites',
+    :testfile => 'testdata/testRunnerGeneratorDependencies.c',
+    :testdefines => ['TEST'],
+    :options => { },
+    :expected => {
+      :to_pass => [ 'test_InitSucceeds',
+                    'test_UsesWhatInitSetUp',
+                    'test_RunsWhenAllItsPrerequisitesPass',
+                  ],
+      :to_fail => [ 'test_ConnectFails' ],
+      :to_ignore => [ 'test_SendIsSkippedWhenConnectFails',
+                      'test_ReceiveIsSkippedWhenSendIsSkipped',
+                    ],
+    }
+  },
+
+  { :name => 'ArgsPrerequisitesNotRunDoNotSkipDependents',
+    :testfile => 'testdata/testRunnerGeneratorDependencies.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-n Send,Receive",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ 'test_SendIsSkippedWhenConnectFails' ],
+      :to_ignore => [ 'test_ReceiveIsSkippedWhenSendIsSkipped' ],
+    }
+  },
+
+  { :name => 'ArgsPrerequisiteFailuresDoNotOutlastTheirRun',
+    :testfile => 'testdata/testRunnerGeneratorDependencies.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'USE_ANOTHER_MAIN'],
+    :options => {
+      :cmdline_args => true,
+      :main_name => "custom_main",
+    },
+    :expected => {
+      :to_pass => [ 'test_InitSucceeds',
+                    'test_UsesWhatInitSetUp',
+                    'test_RunsWhenAllItsPrerequisitesPass',
+                  ],
+      :to_fail => [ 'test_ConnectFails',
+                    'test_SendIsSkippedWhenConnectFails',
+                  ],
+      :to_ignore => [ 'test_SendIsSkippedWhenConnectFails',
+                      'test_ReceiveIsSkippedWhenSendIsSkipped',
+                    ],
+    }
+  },
+
+  { :name => 'ArgsDependentFailsWithoutItsPrerequisite',
+    :testfile => 'testdata/testRunnerGeneratorDependencies.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-n UsesWhatInitSetUp",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ 'test_UsesWhatInitSetUp' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsFailFirstKeepsPrerequisitesFirst',
+    :testfile => 'testdata/testRunnerGeneratorDependencies.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--fail-first",
+    :expected => {
+      :to_pass => [ 'test_InitSucceeds',
+                    'test_UsesWhatInitSetUp',
+                    'test_RunsWhenAllItsPrerequisitesPass',
+                  ],
+      :to_fail => [ 'test_ConnectFails' ],
+      :to_ignore => [ 'test_SendIsSkippedWhenConnectFails',
+                      'test_ReceiveIsSkippedWhenSendIsSkipped',
+                    ],
+    }
+  },
+
+  { :name => 'ArgsDependentFailsWithoutItsPrerequisiteAgain',
+    :testfile => 'testdata/testRunnerGeneratorDependencies.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-n UsesWhatInitSetUp",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ 'test_UsesWhatInitSetUp' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsTimeBudgetKeepsPrerequisitesFirst',
+    :testfile => 'testdata/testRunnerGeneratorDependencies.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_RUN_STATE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--time-budget=10",
+    :expected => {
+      :to_pass => [ 'test_InitSucceeds',
+                    'test_UsesWhatInitSetUp',
+                    'test_RunsWhenAllItsPrerequisitesPass',
+                  ],
+      :to_fail => [ 'test_ConnectFails' ],
+      :to_ignore => [ 'test_SendIsSkippedWhenConnectFails',
+                      'test_ReceiveIsSkippedWhenSendIsSkipped',
+                    ],
+    }
+  },
+
+  { :name => 'ArgsList',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-l",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [  "testRunnerGenerator",
+                  "test_ThisTestAlwaysPasses",
+                  "test_ThisTestAlwaysFails",
+                  "test_ThisTestAlwaysIgnored",
+                  "spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan",
+                  "spec_ThisTestPassesWhenNormalSetupRan",
+                  "spec_ThisTestPassesWhenNormalTeardownRan",
+                  "test_NotBeConfusedByLongComplicatedStrings",
+                  "test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings",
+                  "test_StillNotBeConfusedByLongComplicatedStrings",
+                  "should_RunTestsStartingWithShouldByDefault"
+               ]
+    }
+  },
+
+  { :name => 'ArgsListParameterized',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :test_prefix => "paratest",
+      :use_param_tests => true,
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-l",
+    :features => [ :parameterized ],
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [  "testRunnerGenerator",
+                  'paratest_ShouldHandleParameterizedTests\(25\)',
+                  'paratest_ShouldHandleParameterizedTests\(125\)',
+                  'paratest_ShouldHandleParameterizedTests\(5\)',
+                  'paratest_ShouldHandleParameterizedTests2\(7\)',
+                  'paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid',
+                  'paratest_ShouldHandleParameterizedTestsThatFail\(17\)'
+               ],
+    }
+  },
+
+  { :name => 'ArgsIncompleteIncludeFlags',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-n",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "ERROR: No Test String to Include Matches For" ],
+    }
+  },
+
+  { :name => 'ArgsIncompleteExcludeFlags',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-x",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "ERROR: No Test String to Exclude Matches For" ],
+    }
+  },
+
+  { :name => 'ArgsMissingFilterFile',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS', 'UNITY_INCLUDE_FILTER_FILE'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-n @testdata/NoSuchFilterFile.txt",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "ERROR: Cannot Open Filter File testdata/NoSuchFilterFile.txt" ],
+    }
+  },
+
+  { :name => 'ArgsRerunFailedWithoutRunState',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--rerun-failed",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "ERROR: --rerun-failed Needs UNITY_INCLUDE_RUN_STATE" ],
+    }
+  },
+
+  { :name => 'ArgsIllegalLongFlags',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--rerun-everything",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "ERROR: Unknown Option --rerun-everything" ],
+    }
+  },
+
+  { :name => 'ArgsInvalidShard',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--shard=4/3",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "ERROR: --shard Must Be i/N With 1 <= i <= N" ],
+    }
+  },
+
+  { :name => 'ArgsInvalidFailFast',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--fail-fast=0",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "ERROR: --fail-fast Must Be A Positive Number" ],
+    }
+  },
+
+  { :name => 'ArgsIllegalFlags',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-z",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "ERROR: Unknown Option z" ],
+    }
+  },
+]
+
+def runner_test(test, runner, expected, test_defines, cmdline_args, features)
+  # Tack on TEST define for compiling unit tests
+  load_configuration($cfg_file)
+
+  # Drop Out if we're skipping this type of test
+  if $cfg[:skip_tests] && features
+    if $cfg[:skip_tests].include?(:parameterized) && features.include?(:parameterized)
+      report("Skipping Parameterized Tests for this Target:IGNORE")
+      return true
+    end
+  end
+
+  #compile objects
+  obj_list = [
+    compile(runner, test_defines),
+    compile(test, test_defines),
+    compile('../src/unity.c', test_defines),
+  ]
+
+  run_and_verify(File.basename(test, C_EXTENSION), obj_list, expected, cmdline_args)
+end
+
+def run_and_verify(test_base, obj_list, expected, cmdline_args)
+  # Link the test executable
+  link_it(test_base, obj_list)
+
+  # Execute unit test and generate results file
+  simulator = build_simulator_fields
+  cmdline_args ||= ""
+  executable = $cfg['linker']['bin_files']['destination'] + test_base + $cfg['linker']['bin_files']['extension'] + " #{cmdline_args}"
+  cmd_str = if simulator.nil?
+              executable
+            else
+              "#{simulator[:command]} #{simulator[:pre_support]} #{executable} #{simulator[:post_support]}"
+            end
+  output = execute(cmd_str, true)
+
+  #compare to the expected pass/fail
+  allgood = expected[:to_pass].inject(true)      {|s,v| s && verify_match(/#{v}:PASS/,   output) }
+  allgood = expected[:to_fail].inject(allgood)   {|s,v| s && verify_match(/#{v}:FAIL/,   output) }
+  allgood = expected[:to_ignore].inject(allgood) {|s,v| s && verify_match(/#{v}:IGNORE/, output) }
+
+  #verify there weren't more pass/fail/etc than expected
+  allgood &&= verify_number( expected[:to_pass],   /(:PASS)/,   output)
+  allgood &&= verify_number( expected[:to_fail],   /(:FAIL)/,   output)
+  allgood &&= verify_number( expected[:to_ignore], /(:IGNORE)/, output)
+
+  #if we care about any other text, check that too
+  if (expected[:text])
+    allgood = expected[:text].inject(allgood) {|s,v| s && verify_match(/#{v}/, output) }
+    allgood &&= verify_number( expected[:text], /.+/, output )
+  end
+
+  report output if (!allgood && !$verbose) #report failures if not already reporting everything
   return allgood
 end
 
@@ -1265,4 +2101,75 @@ RUNNER_TESTS.each do |testset|
   end
 end
 
+# These build one runner for several test files, which include their test files themselves
+AGGREGATE_TESTS = [
+  { :name => 'AggregateRunsEveryFileWithItsOwnSetup',
+    :testfiles => ['testdata/testRunnerGeneratorSmall.c', 'testdata/testRunnerGeneratorAggregated.c'],
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => { :cmdline_args => true },
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_ThisTestAlwaysPasses',
+                    'test_OwnSetUpRan',
+                    'test_OwnTearDownRan',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails', 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'AggregateFiltersByFile',
+    :testfiles => ['testdata/testRunnerGeneratorSmall.c', 'testdata/testRunnerGeneratorAggregated.c'],
+    :testdefines => ['TEST', 'UNITY_USE_COMMAND_LINE_ARGS'],
+    :options => { :cmdline_args => true },
+    :cmdline_args => '-n testRunnerGeneratorAggregated:* -x *Fails',
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'test_OwnSetUpRan',
+                    'test_OwnTearDownRan',
+                  ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'AggregateWithoutCommandLineArgs',
+    :testfiles => ['testdata/testRunnerGeneratorAggregated.c', 'testdata/testRunnerGeneratorSmall.c'],
+    :testdefines => ['TEST'],
+    :options => nil,
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'test_OwnSetUpRan',
+                    'test_OwnTearDownRan',
+                    'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails', 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+]
+
+AGGREGATE_TESTS.each do |testset|
+  testset_name = "Runner_#{testset[:name]}"
+  should testset_name do
+    runner_name = OUT_FILE + testset[:name] + '_runner.c'
+    load_configuration($cfg_file)
+    files = UnityTestRunnerGenerator.new(testset[:options]).run_aggregate(testset[:testfiles], runner_name)
+    runners = files.select { |file| File.dirname(file) == File.dirname(runner_name) }
+    obj_list = (runners + ['../src/unity.c']).map { |file| compile(file, testset[:testdefines]) }
+
+    if run_and_verify(File.basename(runner_name, C_EXTENSION), obj_list, testset[:expected], testset[:cmdline_args])
+      report "#{testset_name}:PASS"
+    else
+      report "#{testset_name}:FAIL"
+      $generate_test_runner_failures += 1
+    end
+    $generate_test_runner_tests += 1
+  end
+end
+
 raise "There were #{$generate_test_runner_failures.to_s} failures while testing generate_test_runner.rb" if ($generate_test_runner_failures > 0)
@@ -104,6 +104,8 @@ void testUnitySizeInitializationReminder(void)
         UNITY_COUNTER_TYPE TestIgnores;
         UNITY_COUNTER_TYPE CurrentTestFailed;
         UNITY_COUNTER_TYPE CurrentTestIgnored;
+        UNITY_COUNTER_TYPE CurrentTestExpecting;
+        UNITY_COUNTER_TYPE CurrentTestExpectFailures;
 #ifdef UNITY_INCLUDE_EXEC_TIME
         UNITY_TIME_TYPE CurrentTestStartTime;
         UNITY_TIME_TYPE CurrentTestStopTime;
@@ -124,6 +126,8 @@ void testUnitySizeInitializationReminder(void)
         UNITY_COUNTER_TYPE TestIgnores;
         UNITY_COUNTER_TYPE CurrentTestFailed;
         UNITY_COUNTER_TYPE CurrentTestIgnored;
+        UNITY_COUNTER_TYPE CurrentTestExpecting;
+        UNITY_COUNTER_TYPE CurrentTestExpectFailures;
 #ifdef UNITY_INCLUDE_EXEC_TIME
         UNITY_COUNTER_TYPE CurrentTestStartTime;
         UNITY_COUNTER_TYPE CurrentTestStopTime;
@@ -184,6 +188,74 @@ void testFalse(void)
     TEST_ASSERT_UNLESS(0);
 }
 
+void testExpectPassesLikeAssert(void)
+{
+    TEST_EXPECT(1);
+    TEST_EXPECT_TRUE(1);
+    TEST_EXPECT_FALSE(0);
+    TEST_EXPECT_NULL(NULL);
+    TEST_EXPECT_EQUAL_INT(3, 3);
+    TEST_EXPECT_EQUAL_HEX8(0x5A, 0x5A);
+    TEST_EXPECT_EQUAL_STRING("foo", "foo");
+    TEST_EXPECT_EQUAL_INT_MESSAGE(1, 1, "Custom Message.");
+
+    TEST_ASSERT_EQUAL_INT(0, Unity.CurrentTestExpectFailures);
+    TEST_ASSERT_EQUAL_INT(0, Unity.CurrentTestExpecting);
+}
+
+void testExpectKeepsRunningAfterFailures(void)
+{
+    int reached = 0;
+    UNITY_COUNTER_TYPE failures;
+
+    startPutcharSpy();
+    TEST_EXPECT_EQUAL_INT(1, 2);
+    TEST_EXPECT_TRUE(0);
+    TEST_EXPECT_EQUAL_STRING_MESSAGE("foo", "bar", "Custom Message.");
+    TEST_EXPECT_EQUAL_INT(4, 4);
+    reached = 1;
+    endPutcharSpy();
+
+    failures = Unity.CurrentTestExpectFailures;
+    Unity.CurrentTestExpectFailures = 0;
+    TEST_ASSERT_EQUAL_INT(1, reached);
+    TEST_ASSERT_EQUAL_INT(3, failures);
+    TEST_ASSERT_EQUAL_INT(0, Unity.CurrentTestFailed);
+    TEST_ASSERT_EQUAL_INT(0, Unity.CurrentTestExpecting);
+}
+
+void testExpectThenAssertStillAborts(void)
+{
+    UNITY_COUNTER_TYPE failures;
+
+    EXPECT_ABORT_BEGIN
+    TEST_EXPECT_EQUAL_INT(1, 2);
+    TEST_ASSERT_EQUAL_INT(3, 4);
+    VERIFY_FAILS_END
+
+    failures = Unity.CurrentTestExpectFailures;
+    Unity.CurrentTestExpectFailures = 0;
+    TEST_ASSERT_EQUAL_INT(1, failures);
+}
+
+void testExpectAbortsAfterMaxFailures(void)
+{
+    int i;
+    UNITY_COUNTER_TYPE failures;
+
+    EXPECT_ABORT_BEGIN
+    for (i = 0; i <= UNITY_EXPECT_MAX_FAILURES; i++)
+    {
+        TEST_EXPECT_EQUAL_INT(0, 1);
+    }
+    VERIFY_FAILS_END
+
+    failures = Unity.CurrentTestExpectFailures;
+    Unity.CurrentTestExpectFailures = 0;
+    TEST_ASSERT_EQUAL_INT(UNITY_EXPECT_MAX_FAILURES, failures);
+    TEST_ASSERT_EQUAL_INT(0, Unity.CurrentTestExpecting);
+}
+
 void testPreviousPass(void)
 {
     TEST_ASSERT_EQUAL_INT(0U, Unity.TestFailures);
@@ -458,6 +530,109 @@ void testEqualInts(void)
     TEST_ASSERT_EQUAL_INT(*p0, 19467);
 }
 
+void testEqualIntsEvaluateArgumentsOnce(void)
+{
+    int calls = 0;
+    int v = 5;
+
+    TEST_ASSERT_EQUAL_INT(5, v++);
+    TEST_ASSERT_EQUAL_INT(6, v);
+    TEST_ASSERT_EQUAL_UINT8(++calls, 1);
+    TEST_ASSERT_EQUAL_INT(1, calls);
+
+    if (v == 6)
+        TEST_ASSERT_EQUAL_INT(6, v);
+    else
+        TEST_FAIL_MESSAGE("Assertion macro broke if/else");
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT(7, v++);
+    VERIFY_FAILS_END
+    TEST_ASSERT_EQUAL_INT(7, v);
+}
+
+void testEqualGeneric(void)
+{
+#ifndef UNITY_SUPPORT_GENERIC
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQ(1, 1);
+    VERIFY_FAILS_END
+#else
+    char c = 'x';
+    signed char sc = -5;
+    unsigned char uc = 250;
+    short s = -30000;
+    unsigned short us = 60000;
+    int i = -19467;
+    unsigned int ui = 19467u;
+    long l = -123456L;
+    unsigned long ul = 123456UL;
+    _Bool b = 1;
+    int n = 0;
+
+    TEST_ASSERT_EQ('x', c);
+    TEST_ASSERT_EQ(-5, sc);
+    TEST_ASSERT_EQ(250, uc);
+    TEST_ASSERT_EQ(-30000, s);
+    TEST_ASSERT_EQ(60000, us);
+    TEST_ASSERT_EQ(-19467, i);
+    TEST_ASSERT_EQ(19467u, ui);
+    TEST_ASSERT_EQ(-123456L, l);
+    TEST_ASSERT_EQ(123456UL, ul);
+    TEST_ASSERT_EQ(1, b);
+    TEST_ASSERT_EQ(1, ++n);
+    TEST_ASSERT_EQ(1, n);
+    TEST_ASSERT_EQ_MESSAGE(i, -19467, "Custom Message.");
+#endif
+}
+
+void testNotEqualGeneric(void)
+{
+#ifndef UNITY_SUPPORT_GENERIC
+    TEST_IGNORE();
+#else
+    unsigned char uc = 250;
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQ(251, uc);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testNotEqualGenericMessage(void)
+{
+#ifndef UNITY_SUPPORT_GENERIC
+    TEST_IGNORE();
+#else
+    short s = -30000;
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQ_MESSAGE(-30001, s, "Custom Message.");
+    VERIFY_FAILS_END
+#endif
+}
+
+void testEqualGeneric64(void)
+{
+#ifndef UNITY_SUPPORT_GENERIC
+    TEST_IGNORE();
+#else
+    unsigned long long v = 0x8000000000000000;
+
+#ifdef UNITY_SUPPORT_64
+    TEST_ASSERT_EQ(0x8000000000000000, v);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQ(0x8000000000000001, v);
+    VERIFY_FAILS_END
+#else
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQ(0x8000000000000000, v);
+    VERIFY_FAILS_END
+#endif
+#endif
+}
+
 void testEqualInt8s(void)
 {
     UNITY_INT8 v0, v1;
@@ -836,6 +1011,79 @@ void testNotEqualBitsLow(void)
     VERIFY_FAILS_END
 }
 
+void testEqualBitsArray(void)
+{
+    UNITY_UINT32 masks[]    = {0xFFFF0000, 0x0000FFFF, 0x00000000};
+    UNITY_UINT32 expected[] = {0x12345678, 0x12345678, 0x12345678};
+    UNITY_UINT32 actual[]   = {0x1234ABCD, 0xABCD5678, 0xFFFFFFFF};
+    UNITY_UINT8  masks8[]   = {0xF0, 0x0F};
+    UNITY_UINT8  exp8[]     = {0xA5, 0xA5};
+    UNITY_UINT8  act8[]     = {0xAF, 0xF5};
+    UNITY_UINT16 masks16[]  = {0x8001};
+    UNITY_UINT16 exp16[]    = {0x8001};
+    UNITY_UINT16 act16[]    = {0xFFFF};
+    unsigned int masksi[]   = {0x1, 0x2};
+    unsigned int expi[]     = {0x1, 0x0};
+    unsigned int acti[]     = {0xF, 0xD};
+
+    TEST_ASSERT_BITS32_ARRAY(masks, expected, actual, 3);
+    TEST_ASSERT_BITS32_ARRAY(masks, expected, expected, 3);
+    TEST_ASSERT_BITS8_ARRAY(masks8, exp8, act8, 2);
+    TEST_ASSERT_BITS16_ARRAY_MESSAGE(masks16, exp16, act16, 1, "Custom Message.");
+    TEST_ASSERT_BITS_ARRAY(masksi, expi, acti, 2);
+}
+
+void testNotEqualBitsArray(void)
+{
+    UNITY_UINT32 masks[]    = {0xFFFF0000, 0x0000FFFF, 0x00000001};
+    UNITY_UINT32 expected[] = {0x12345678, 0x12345678, 0x12345678};
+    UNITY_UINT32 actual[]   = {0x1234ABCD, 0xABCD5678, 0xFFFFFFFF};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_BITS32_ARRAY(masks, expected, actual, 3);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualBits8ArrayMessage(void)
+{
+    UNITY_UINT8 masks[]    = {0xF0, 0x0F};
+    UNITY_UINT8 expected[] = {0xA5, 0xA5};
+    UNITY_UINT8 actual[]   = {0xA5, 0xA4};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_BITS8_ARRAY_MESSAGE(masks, expected, actual, 2, "Custom Message.");
+    VERIFY_FAILS_END
+}
+
+void testBitsArrayNullMask(void)
+{
+    UNITY_UINT8 expected[] = {0xA5, 0xA5};
+    UNITY_UINT8 actual[]   = {0xA5, 0xA5};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_BITS8_ARRAY(NULL, expected, actual, 2);
+    VERIFY_FAILS_END
+}
+
+void testEqualBits64Array(void)
+{
+#ifndef UNITY_SUPPORT_64
+    TEST_IGNORE();
+#else
+    UNITY_UINT64 masks[]    = {0xFFFFFFFF00000000};
+    UNITY_UINT64 expected[] = {0x0123456789ABCDEF};
+    UNITY_UINT64 actual[]   = {0x0123456700000000};
+
+    TEST_ASSERT_BITS64_ARRAY(masks, expected, actual, 1);
+
+    masks[0] = 0x0000000100000000;
+    actual[0] = 0;
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_BITS64_ARRAY(masks, expected, actual, 1);
+    VERIFY_FAILS_END
+#endif
+}
+
 
 void testEqualShorts(void)
 {
@@ -4490,6 +4738,136 @@ void testNotEqualString_ActualStringIsLonger(void)
     VERIFY_FAILS_END
 }
 
+void testStringContains(void)
+{
+    const char* log = "boot: ok\ninit: loading modules\ninit: 3 modules loaded\n";
+
+    TEST_ASSERT_STRING_CONTAINS("init: 3 modules", log);
+    TEST_ASSERT_STRING_CONTAINS("boot", log);
+    TEST_ASSERT_STRING_CONTAINS("loaded\n", log);
+    TEST_ASSERT_STRING_CONTAINS("", log);
+    TEST_ASSERT_STRING_CONTAINS(log, log);
+    TEST_ASSERT_STRING_CONTAINS_MESSAGE("abab", "aabababb", "Custom Message.");
+    TEST_ASSERT_STRING_CONTAINS(NULL, NULL);
+}
+
+void testStringContainsPeriodicNeedle(void)
+{
+    char haystack[401];
+    int i;
+
+    /* Highly periodic text is the worst case for naive searching */
+    for (i = 0; i < 400; i++)
+    {
+        haystack[i] = 'a';
+    }
+    haystack[400] = '\0';
+    TEST_ASSERT_STRING_CONTAINS("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", haystack);
+
+    haystack[399] = 'b';
+    TEST_ASSERT_STRING_CONTAINS("aaaaaaaaaaaaaaaaaaaaaaaaaaab", haystack);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_CONTAINS("aaaaaaaaaaaaaaaaaaaaaaaaaaaba", haystack);
+    VERIFY_FAILS_END
+}
+
+void testStringNotContains(void)
+{
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_CONTAINS("modules unloaded", "init: 3 modules loaded");
+    VERIFY_FAILS_END
+}
+
+void testStringNotContainsLongerNeedle(void)
+{
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_CONTAINS_MESSAGE("init: 3 modules loaded", "init", "Custom Message.");
+    VERIFY_FAILS_END
+}
+
+void testStringContainsNullActual(void)
+{
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_CONTAINS("init", NULL);
+    VERIFY_FAILS_END
+}
+
+void testStringContainsNullNeedle(void)
+{
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_CONTAINS(NULL, "init");
+    VERIFY_FAILS_END
+}
+
+void testStringStartsWith(void)
+{
+    TEST_ASSERT_STRING_STARTS_WITH("init", "init: 3 modules loaded");
+    TEST_ASSERT_STRING_STARTS_WITH("init: 3 modules loaded", "init: 3 modules loaded");
+    TEST_ASSERT_STRING_STARTS_WITH("", "init");
+    TEST_ASSERT_STRING_STARTS_WITH_MESSAGE("i", "init", "Custom Message.");
+}
+
+void testStringNotStartsWith(void)
+{
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_STARTS_WITH("3 modules", "init: 3 modules loaded");
+    VERIFY_FAILS_END
+}
+
+void testStringNotStartsWithLongerPrefix(void)
+{
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_STARTS_WITH("init: ok", "init");
+    VERIFY_FAILS_END
+}
+
+void testStringEndsWith(void)
+{
+    TEST_ASSERT_STRING_ENDS_WITH("loaded", "init: 3 modules loaded");
+    TEST_ASSERT_STRING_ENDS_WITH("init: 3 modules loaded", "init: 3 modules loaded");
+    TEST_ASSERT_STRING_ENDS_WITH("", "init");
+    TEST_ASSERT_STRING_ENDS_WITH_MESSAGE("t", "init", "Custom Message.");
+}
+
+void testStringNotEndsWith(void)
+{
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_ENDS_WITH("modules", "init: 3 modules loaded");
+    VERIFY_FAILS_END
+}
+
+void testStringNotEndsWithLongerSuffix(void)
+{
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_ENDS_WITH("pre-init", "init");
+    VERIFY_FAILS_END
+}
+
+void testStringMatchesGlob(void)
+{
+    TEST_ASSERT_STRING_MATCHES_GLOB("init: ? modules *", "init: 3 modules loaded");
+    TEST_ASSERT_STRING_MATCHES_GLOB("*", "");
+    TEST_ASSERT_STRING_MATCHES_GLOB("*loaded", "init: 3 modules loaded");
+    TEST_ASSERT_STRING_MATCHES_GLOB("*mod*mod*", "modules: mod_a mod_b");
+    TEST_ASSERT_STRING_MATCHES_GLOB("", "");
+    TEST_ASSERT_STRING_MATCHES_GLOB_MESSAGE("a*b?c", "axxbyc", "Custom Message.");
+}
+
+void testStringNotMatchesGlob(void)
+{
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_MATCHES_GLOB("init: ? modules", "init: 3 modules loaded");
+    VERIFY_FAILS_END
+}
+
+void testStringNotMatchesGlobMissingCharacter(void)
+{
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_MATCHES_GLOB("init?", "init");
+    VERIFY_FAILS_END
+}
+
 void testEqualStringArrays(void)
 {
     const char *testStrings[] = { "foo", "boo", "woo", "moo" };
@@ -4681,105 +5059,1048 @@ void testNotEqualMemoryLengthZero(void)
     VERIFY_FAILS_END
 }
 
-void testEqualIntArrays(void)
+void testEqualMemoryMasked(void)
 {
-    int p0[] = {1, 8, 987, -2};
-    int p1[] = {1, 8, 987, -2};
-    int p2[] = {1, 8, 987, 2};
-    int p3[] = {1, 500, 600, 700};
+    /* header, 4-byte timestamp we do not care about, payload with a padding byte */
+    unsigned char expected[] = {0xA5, 0x01, 0x00, 0x00, 0x00, 0x00, 'u', 'n', 0x00, 'y'};
+    unsigned char actual[]   = {0xA5, 0x01, 0x12, 0x34, 0x56, 0x78, 'u', 'n', 0x7F, 'y'};
+    unsigned char mask[]     = {0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF};
+    unsigned char big_expected[300];
+    unsigned char big_actual[300];
+    unsigned char big_mask[300];
+    int i;
 
-    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p0, 1);
-    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p0, 4);
-    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
-    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p2, 3);
-    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p3, 1);
-    TEST_ASSERT_EQUAL_INT_ARRAY(NULL, NULL, 1);
+    for (i = 0; i < 300; i++)
+    {
+        big_expected[i] = (unsigned char)i;
+        big_actual[i]   = (unsigned char)(i | 0x80);
+        big_mask[i]     = 0x7F;
+    }
+
+    TEST_ASSERT_EQUAL_MEMORY_MASKED(expected, actual, mask, sizeof(expected));
+    TEST_ASSERT_EQUAL_MEMORY_MASKED(expected, expected, NULL, sizeof(expected));
+    TEST_ASSERT_EQUAL_MEMORY_MASKED(big_expected, big_actual, big_mask, 300);
+    TEST_ASSERT_EQUAL_MEMORY_MASKED_MESSAGE(expected, actual, mask, 2, "Custom Message.");
 }
 
-void testNotEqualIntArraysNullExpected(void)
+void testNotEqualMemoryMasked(void)
 {
-    int* p0 = NULL;
-    int p1[] = {1, 8, 987, 2};
+    unsigned char expected[] = {0xA5, 0x01, 0x00, 0x00, 'u'};
+    unsigned char actual[]   = {0xA5, 0x01, 0x12, 0x34, 'U'};
+    unsigned char mask[]     = {0xFF, 0xFF, 0x00, 0x00, 0xFF};
 
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
+    TEST_ASSERT_EQUAL_MEMORY_MASKED(expected, actual, mask, sizeof(expected));
     VERIFY_FAILS_END
 }
 
-void testNotEqualIntArraysNullActual(void)
+void testNotEqualMemoryMaskedPastFirstBlock(void)
 {
-    int* p1 = NULL;
-    int p0[] = {1, 8, 987, 2};
+    unsigned char expected[300];
+    unsigned char actual[300];
+    unsigned char mask[300];
+    int i;
+
+    for (i = 0; i < 300; i++)
+    {
+        expected[i] = (unsigned char)i;
+        actual[i]   = (unsigned char)i;
+        mask[i]     = 0xFF;
+    }
+    actual[299] = 0;
 
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
+    TEST_ASSERT_EQUAL_MEMORY_MASKED_MESSAGE(expected, actual, mask, 300, "Custom Message.");
     VERIFY_FAILS_END
 }
 
-void testNotEqualIntArrays1(void)
+void testNotEqualMemoryMaskedNullActual(void)
 {
-    int p0[] = {1, 8, 987, -2};
-    int p1[] = {1, 8, 987, 2};
+    unsigned char expected[] = {0xA5};
+    unsigned char mask[]     = {0xFF};
 
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
+    TEST_ASSERT_EQUAL_MEMORY_MASKED(expected, NULL, mask, 1);
     VERIFY_FAILS_END
 }
 
-void testNotEqualIntArrays2(void)
+void testNotEqualMemoryMaskedNullMask(void)
 {
-    int p0[] = {1, 8, 987, -2};
-    int p1[] = {2, 8, 987, -2};
+    unsigned char expected[] = {0xA5};
+    unsigned char actual[]   = {0xA5};
 
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
+    TEST_ASSERT_EQUAL_MEMORY_MASKED(expected, actual, NULL, 1);
     VERIFY_FAILS_END
 }
 
-void testNotEqualIntArrays3(void)
+void testNotEqualMemoryMaskedLengthZero(void)
 {
-    int p0[] = {1, 8, 987, -2};
-    int p1[] = {1, 8, 986, -2};
+    unsigned char expected[] = {0xA5};
 
     EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
+    TEST_ASSERT_EQUAL_MEMORY_MASKED(expected, expected, expected, 0);
     VERIFY_FAILS_END
 }
 
-void testNotEqualIntArraysLengthZero(void)
+void testMemoryHash(void)
 {
-    UNITY_UINT32 p0[1] = {1};
-    UNITY_UINT32 p1[1] = {1};
+#ifndef UNITY_SUPPORT_64
+    TEST_IGNORE();
+#else
+    const char* phrase = "Nobody inspects the spammish repetition";
 
-    EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 0);
-    VERIFY_FAILS_END
+    TEST_ASSERT_MEMORY_HASH(0xEF46DB3751D8E999, "", 0);
+    TEST_ASSERT_MEMORY_HASH(0xEF46DB3751D8E999, NULL, 0);
+    TEST_ASSERT_MEMORY_HASH(0xD24EC4F1A98C6E5B, "a", 1);
+    TEST_ASSERT_MEMORY_HASH(0x44BC2CF5AD770999, "abc", 3);
+    TEST_ASSERT_MEMORY_HASH_MESSAGE(0xFBCEA83C8A378BF1, phrase, strlen(phrase), "Custom Message.");
+    TEST_ASSERT_EQUAL_HEX64(0x44BC2CF5AD770999, UnityHash("abc", 3));
+#endif
 }
 
-void testEqualIntEachEqual(void)
+void testMemoryHashIncrementalMatchesOneShot(void)
 {
-    int p0[] = {1, 1, 1, 1};
-    int p1[] = {987, 987, 987, 987};
-    int p2[] = {-2, -2, -2, -3};
-    int p3[] = {1, 5, 600, 700};
+#ifndef UNITY_SUPPORT_64
+    TEST_IGNORE();
+#else
+    unsigned char buffer[1061];
+    const UNITY_UINT chunks[] = {1, 7, 31, 33, 64, 0, 900};
+    UNITY_HASH_T state;
+    UNITY_UINT used = 0;
+    unsigned int i;
 
-    TEST_ASSERT_EACH_EQUAL_INT(1, p0, 1);
-    TEST_ASSERT_EACH_EQUAL_INT(1, p0, 4);
-    TEST_ASSERT_EACH_EQUAL_INT(987, p1, 4);
-    TEST_ASSERT_EACH_EQUAL_INT(-2, p2, 3);
-    TEST_ASSERT_EACH_EQUAL_INT(1, p3, 1);
-}
+    for (i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = (unsigned char)(i & 0xFF);
+    }
 
-void testNotEqualIntEachEqualNullActual(void)
-{
-    int* p1 = NULL;
+    UnityHash_Init(&state);
+    for (i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++)
+    {
+        UnityHash_Update(&state, &buffer[used], chunks[i]);
+        used += chunks[i];
+    }
+    UnityHash_Update(&state, &buffer[used], sizeof(buffer) - used);
 
-    EXPECT_ABORT_BEGIN
-    TEST_ASSERT_EACH_EQUAL_INT(1, p1, 4);
-    VERIFY_FAILS_END
+    TEST_ASSERT_EQUAL_HASH(0x993908AD297ACB7C, &state);
+    TEST_ASSERT_EQUAL_HASH_MESSAGE(UnityHash(buffer, sizeof(buffer)), &state, "Custom Message.");
+#endif
 }
 
-void testNotEqualIntEachEqual1(void)
+void testNotEqualMemoryHash(void)
+{
+#ifndef UNITY_SUPPORT_64
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_MEMORY_HASH(0x44BC2CF5AD770999, "abd", 3);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testNotEqualHashState(void)
+{
+#ifndef UNITY_SUPPORT_64
+    TEST_IGNORE();
+#else
+    UNITY_HASH_T state;
+
+    UnityHash_Init(&state);
+    UnityHash_Update(&state, "ab", 2);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_HASH(0x44BC2CF5AD770999, &state);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testNotEqualMemoryHashNullActual(void)
+{
+#ifndef UNITY_SUPPORT_64
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_MEMORY_HASH(0x44BC2CF5AD770999, NULL, 3);
+    VERIFY_FAILS_END
+#endif
+}
+
+#ifdef UNITY_INCLUDE_GOLDEN_FILE
+#define GOLDEN_TEST_PATH "build/testunity_golden.bin"
+
+static void writeGoldenTestFile(const char* contents, size_t len)
+{
+    FILE* file = fopen(GOLDEN_TEST_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(len, fwrite(contents, 1, len, file));
+    TEST_ASSERT_EQUAL_INT(0, fclose(file));
+}
+
+/* long enough that the golden file is read in several chunks, the last one partial */
+#define GOLDEN_TEST_LONG_LEN ((UNITY_GOLDEN_FILE_BUFFER_SIZE * 2) + 17)
+static char goldenTestLong[GOLDEN_TEST_LONG_LEN];
+
+static void writeLongGoldenTestFile(void)
+{
+    size_t i;
+    for (i = 0; i < sizeof(goldenTestLong); i++)
+    {
+        goldenTestLong[i] = (char)('a' + (i % 23));
+    }
+    writeGoldenTestFile(goldenTestLong, sizeof(goldenTestLong));
+}
+#endif
+
+void testGoldenFileMatches(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    writeGoldenTestFile("golden\0bytes", 12);
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, "golden\0bytes", 12);
+    TEST_ASSERT_MATCHES_GOLDEN_FILE_MESSAGE(GOLDEN_TEST_PATH, "golden\0bytes", 12, "Custom Message.");
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+void testGoldenFileEmptyMatchesNull(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    writeGoldenTestFile("", 0);
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, NULL, 0);
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+void testGoldenFileByteMismatch(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    writeGoldenTestFile("golden bytes", 12);
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, "golden bites", 12);
+    VERIFY_FAILS_END
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+void testGoldenFileShorterThanActual(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    writeGoldenTestFile("golden", 6);
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, "golden bytes", 12);
+    VERIFY_FAILS_END
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+void testGoldenFileLongerThanActual(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    writeGoldenTestFile("golden bytes", 12);
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, "golden", 6);
+    VERIFY_FAILS_END
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+void testGoldenFileLongerThanOneChunkMatches(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    writeLongGoldenTestFile();
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, goldenTestLong, sizeof(goldenTestLong));
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+void testGoldenFileMismatchInLastChunk(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    writeLongGoldenTestFile();
+    goldenTestLong[sizeof(goldenTestLong) - 1] = '!';
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, goldenTestLong, sizeof(goldenTestLong));
+    VERIFY_FAILS_END
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+void testGoldenFileMismatchAtStartOfSecondChunk(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    writeLongGoldenTestFile();
+    goldenTestLong[UNITY_GOLDEN_FILE_BUFFER_SIZE] = '!';
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, goldenTestLong, sizeof(goldenTestLong));
+    VERIFY_FAILS_END
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+void testGoldenFileLongerThanActualPastFirstChunk(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    writeLongGoldenTestFile();
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, goldenTestLong, sizeof(goldenTestLong) - 1);
+    VERIFY_FAILS_END
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+void testGoldenFileMissing(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    remove(GOLDEN_TEST_PATH);
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, "golden", 6);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testGoldenFileNullActual(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    writeGoldenTestFile("golden", 6);
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, NULL, 6);
+    VERIFY_FAILS_END
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+void testGoldenFileUpdateRewritesMismatch(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    FILE* leftover;
+
+    writeGoldenTestFile("old golden contents", 19);
+    UnityGoldenFileUpdate = 1;
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, "new", 3);
+    UnityGoldenFileUpdate = 0;
+
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, "new", 3);
+    leftover = fopen(GOLDEN_TEST_PATH ".tmp", "rb");
+    TEST_ASSERT_NULL(leftover);
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+void testGoldenFileUpdateCreatesMissingFile(void)
+{
+#ifndef UNITY_INCLUDE_GOLDEN_FILE
+    TEST_IGNORE();
+#else
+    remove(GOLDEN_TEST_PATH);
+    UnityGoldenFileUpdate = 1;
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, "created", 7);
+    UnityGoldenFileUpdate = 0;
+
+    TEST_ASSERT_MATCHES_GOLDEN_FILE(GOLDEN_TEST_PATH, "created", 7);
+    remove(GOLDEN_TEST_PATH);
+#endif
+}
+
+#ifdef UNITY_INCLUDE_STATE_SNAPSHOT
+static int snapshotCounter = 7;
+static char snapshotName[8] = "clean";
+#ifdef UNITY_SNAPSHOT_STATE
+static int snapshotMarked UNITY_SNAPSHOT_STATE = 3;
+#endif
+#endif
+
+void testSnapshotRestoresRegisteredVariables(void)
+{
+#ifndef UNITY_INCLUDE_STATE_SNAPSHOT
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_EQUAL_INT(0, TEST_SNAPSHOT(snapshotCounter));
+    TEST_ASSERT_EQUAL_INT(0, TEST_SNAPSHOT_REGION(snapshotName, sizeof(snapshotName)));
+    snapshotCounter = 99;
+    snapshotName[0] = 'D';
+
+    UnitySnapshotRestore();
+    UnitySnapshotClear();
+    TEST_ASSERT_EQUAL_INT(7, snapshotCounter);
+    TEST_ASSERT_EQUAL_STRING("clean", snapshotName);
+#endif
+}
+
+void testSnapshotTakesFreshCopyWhenRegisteredAgain(void)
+{
+#ifndef UNITY_INCLUDE_STATE_SNAPSHOT
+    TEST_IGNORE();
+#else
+    int i;
+
+    for (i = 0; i < UNITY_SNAPSHOT_REGIONS + 1; i++)
+    {
+        snapshotCounter = i;
+        TEST_ASSERT_EQUAL_INT(0, TEST_SNAPSHOT(snapshotCounter));
+    }
+    snapshotCounter = -1;
+
+    UnitySnapshotRestore();
+    UnitySnapshotClear();
+    TEST_ASSERT_EQUAL_INT(UNITY_SNAPSHOT_REGIONS, snapshotCounter);
+    snapshotCounter = 7;
+#endif
+}
+
+void testSnapshotRefusesMoreThanItsBufferHolds(void)
+{
+#ifndef UNITY_INCLUDE_STATE_SNAPSHOT
+    TEST_IGNORE();
+#else
+    static unsigned char tooBig[UNITY_SNAPSHOT_BYTES + 1];
+    int result;
+
+    startPutcharSpy();
+    result = TEST_SNAPSHOT(tooBig);
+    endPutcharSpy();
+    UnitySnapshotClear();
+    TEST_ASSERT_EQUAL_INT(1, result);
+#ifdef USING_OUTPUT_SPY
+    TEST_ASSERT_EQUAL_STRING_LEN("ERROR: State Snapshots Need More", getBufferPutcharSpy(), 32);
+#endif
+#endif
+}
+
+void testSnapshotOfMarkedState(void)
+{
+#if !defined(UNITY_INCLUDE_STATE_SNAPSHOT) || !defined(UNITY_SNAPSHOT_STATE)
+    TEST_IGNORE();
+#else
+    TEST_ASSERT_EQUAL_INT(0, TEST_SNAPSHOT_STATE());
+    snapshotMarked = 4;
+
+    UnitySnapshotRestore();
+    UnitySnapshotClear();
+    TEST_ASSERT_EQUAL_INT(3, snapshotMarked);
+#endif
+}
+
+void testEqualIntArrays(void)
+{
+    int p0[] = {1, 8, 987, -2};
+    int p1[] = {1, 8, 987, -2};
+    int p2[] = {1, 8, 987, 2};
+    int p3[] = {1, 500, 600, 700};
+
+    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p0, 1);
+    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p0, 4);
+    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
+    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p2, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p3, 1);
+    TEST_ASSERT_EQUAL_INT_ARRAY(NULL, NULL, 1);
+}
+
+void testNotEqualIntArraysNullExpected(void)
+{
+    int* p0 = NULL;
+    int p1[] = {1, 8, 987, 2};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualIntArraysNullActual(void)
+{
+    int* p1 = NULL;
+    int p0[] = {1, 8, 987, 2};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualIntArrays1(void)
+{
+    int p0[] = {1, 8, 987, -2};
+    int p1[] = {1, 8, 987, 2};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualIntArrays2(void)
+{
+    int p0[] = {1, 8, 987, -2};
+    int p1[] = {2, 8, 987, -2};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualIntArrays3(void)
+{
+    int p0[] = {1, 8, 987, -2};
+    int p1[] = {1, 8, 986, -2};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 4);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualIntArraysLengthZero(void)
+{
+    UNITY_UINT32 p0[1] = {1};
+    UNITY_UINT32 p1[1] = {1};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_ARRAY(p0, p1, 0);
+    VERIFY_FAILS_END
+}
+
+struct StridedSample
+{
+    UNITY_INT16 id;
+    int value;
+    char tag;
+};
+
+void testEqualIntArraysStrided(void)
+{
+    struct StridedSample s[3] = {{1, 10, 'a'}, {2, -20, 'b'}, {3, 987, 'c'}};
+    UNITY_INT16 ids[] = {1, 2, 3};
+    int values[] = {10, -20, 987};
+    char tags[] = {'a', 'b', 'c'};
+
+    TEST_ASSERT_EQUAL_INT16_ARRAY_STRIDED(ids, s, sizeof(s[0]), offsetof(struct StridedSample, id), 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED(values, s, sizeof(s[0]), offsetof(struct StridedSample, value), 3);
+    TEST_ASSERT_EQUAL_CHAR_ARRAY_STRIDED(tags, s, sizeof(s[0]), offsetof(struct StridedSample, tag), 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED(values, &s[0].value, sizeof(s[0]), 0, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED(values, values, 0, 0, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED(NULL, NULL, sizeof(s[0]), offsetof(struct StridedSample, value), 1);
+}
+
+void testEqualIntArraysStridedWithMessage(void)
+{
+    struct StridedSample s[2] = {{1, 10, 'a'}, {2, -20, 'b'}};
+    int values[] = {10, -20};
+
+    TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED_MESSAGE(values, s, sizeof(s[0]), offsetof(struct StridedSample, value), 2, "Custom Message.");
+}
+
+void testNotEqualIntArraysStrided(void)
+{
+    struct StridedSample s[3] = {{1, 10, 'a'}, {2, -20, 'b'}, {3, 986, 'c'}};
+    int values[] = {10, -20, 987};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED(values, s, sizeof(s[0]), offsetof(struct StridedSample, value), 3);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualIntArraysStridedSameBaseDifferentField(void)
+{
+    int pairs[] = {1, 1, 2, 3};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED(pairs, pairs, 2 * sizeof(int), sizeof(int), 2);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualIntArraysStridedNullActual(void)
+{
+    int values[] = {10, -20, 987};
+    struct StridedSample* s = NULL;
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED(values, s, sizeof(struct StridedSample), offsetof(struct StridedSample, value), 3);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualIntArraysStridedLengthZero(void)
+{
+    struct StridedSample s[1] = {{1, 10, 'a'}};
+    int values[1] = {10};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_INT_ARRAY_STRIDED(values, s, sizeof(s[0]), offsetof(struct StridedSample, value), 0);
+    VERIFY_FAILS_END
+}
+
+void testIntArrayWithinDeltaStrided(void)
+{
+    struct StridedSample s[3] = {{1, 5000, 'a'}, {2, -4995, 'b'}, {3, 5005, 'c'}};
+    int expected[] = {5001, -4996, 5004};
+
+    TEST_ASSERT_INT_ARRAY_WITHIN_STRIDED(1, expected, s, sizeof(s[0]), offsetof(struct StridedSample, value), 3);
+    TEST_ASSERT_INT_ARRAY_WITHIN_STRIDED_MESSAGE(1, expected, s, sizeof(s[0]), offsetof(struct StridedSample, value), 3, "Custom Message.");
+}
+
+void testIntArrayNotWithinDeltaStrided(void)
+{
+    struct StridedSample s[3] = {{1, 5000, 'a'}, {2, -4995, 'b'}, {3, 5005, 'c'}};
+    int expected[] = {5001, -4996, 5007};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_WITHIN_STRIDED(1, expected, s, sizeof(s[0]), offsetof(struct StridedSample, value), 3);
+    VERIFY_FAILS_END
+}
+
+void testUInt8ArrayWithinDeltaStridedOverInterleavedBytes(void)
+{
+    UNITY_UINT8 rgb[] = {10, 200, 30, 11, 201, 31, 12, 202, 32};
+    UNITY_UINT8 greens[] = {199, 200, 201};
+
+    TEST_ASSERT_UINT8_ARRAY_WITHIN_STRIDED(2, greens, rgb, 3, 1, 3);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_UINT8_ARRAY_WITHIN_STRIDED(0, greens, rgb, 3, 1, 3);
+    VERIFY_FAILS_END
+}
+
+void testEqualInt64ArraysStrided(void)
+{
+#ifndef UNITY_SUPPORT_64
+    TEST_IGNORE();
+#else
+    struct { UNITY_INT64 key; UNITY_UINT64 mask; } s[2] = {{-1, 0x8000000000000000}, {2, 0x1}};
+    UNITY_INT64 keys[] = {-1, 2};
+    UNITY_UINT64 masks[] = {0x8000000000000000, 0x2};
+
+    TEST_ASSERT_EQUAL_INT64_ARRAY_STRIDED(keys, s, sizeof(s[0]), 0, 2);
+    TEST_ASSERT_UINT64_ARRAY_WITHIN_STRIDED(1, masks, s, sizeof(s[0]), sizeof(UNITY_INT64), 2);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_HEX64_ARRAY_STRIDED(masks, s, sizeof(s[0]), sizeof(UNITY_INT64), 2);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testIntArrayPermutation(void)
+{
+    int p0[] = {1, 8, -987, 8, 65132};
+    int p1[] = {8, 65132, 1, -987, 8};
+    int p2[] = {1, 8, -987, 8, 65132};
+
+    TEST_ASSERT_INT_ARRAY_PERMUTATION(p0, p0, 5);
+    TEST_ASSERT_INT_ARRAY_PERMUTATION(p0, p1, 5);
+    TEST_ASSERT_INT_ARRAY_PERMUTATION(p0, p2, 5);
+    TEST_ASSERT_INT_ARRAY_PERMUTATION_MESSAGE(p1, p0, 5, "Custom Message.");
+}
+
+void testIntArrayNotPermutationDuplicateCounts(void)
+{
+    int p0[] = {1, 2, 2, 3};
+    int p1[] = {3, 2, 1, 3};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_PERMUTATION(p0, p1, 4);
+    VERIFY_FAILS_END
+}
+
+void testIntArrayNotPermutationValueMissing(void)
+{
+    int p0[] = {1, 2, 3, 4};
+    int p1[] = {4, 3, 9, 1};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_PERMUTATION_MESSAGE(p0, p1, 4, "Custom Message.");
+    VERIFY_FAILS_END
+}
+
+void testIntArrayPermutationNullActual(void)
+{
+    int p0[] = {1, 2, 3, 4};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_PERMUTATION(p0, NULL, 4);
+    VERIFY_FAILS_END
+}
+
+void testIntArrayPermutationLengthZero(void)
+{
+    int p0[] = {1, 2, 3, 4};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_PERMUTATION(p0, p0, 0);
+    VERIFY_FAILS_END
+}
+
+void testSmallIntArraysPermutation(void)
+{
+    UNITY_INT8   i8a[]  = {-1, 127, -128, 0};
+    UNITY_INT8   i8b[]  = {0, -128, -1, 127};
+    UNITY_UINT16 u16a[] = {65535, 1, 65535};
+    UNITY_UINT16 u16b[] = {65535, 65535, 1};
+    UNITY_UINT32 h32a[] = {0xDEADBEEF, 0xFEEDFACE};
+    UNITY_UINT32 h32b[] = {0xFEEDFACE, 0xDEADBEEF};
+    char         ca[]   = "unity";
+    char         cb[]   = "yunit";
+
+    TEST_ASSERT_INT8_ARRAY_PERMUTATION(i8a, i8b, 4);
+    TEST_ASSERT_UINT16_ARRAY_PERMUTATION(u16a, u16b, 3);
+    TEST_ASSERT_HEX32_ARRAY_PERMUTATION(h32a, h32b, 2);
+    TEST_ASSERT_CHAR_ARRAY_PERMUTATION(ca, cb, 5);
+
+    u16b[0] = 1;
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_UINT16_ARRAY_PERMUTATION(u16a, u16b, 3);
+    VERIFY_FAILS_END
+}
+
+void testInt64ArrayPermutation(void)
+{
+#ifndef UNITY_SUPPORT_64
+    TEST_IGNORE();
+#else
+    UNITY_INT64 p0[] = {0x7FFFFFFFFFFFFFFF, -1, 0x100000000};
+    UNITY_INT64 p1[] = {0x100000000, 0x7FFFFFFFFFFFFFFF, -1};
+    UNITY_INT64 p2[] = {0x100000000, 0x7FFFFFFFFFFFFFFF, 0};
+
+    TEST_ASSERT_INT64_ARRAY_PERMUTATION(p0, p1, 3);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT64_ARRAY_PERMUTATION(p0, p2, 3);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testIntArrayPermutationLargerThanStaticScratchFails(void)
+{
+    /* More elements than the static scratch table fail, asking for scratch, even when they match */
+#if (UNITY_ARRAY_SCRATCH_SLOTS == 0)
+    TEST_IGNORE();
+#else
+    UNITY_UINT16 forward[(UNITY_ARRAY_SCRATCH_SLOTS * 2) + 4];
+    UNITY_UINT16 backward[(UNITY_ARRAY_SCRATCH_SLOTS * 2) + 4];
+    const UNITY_UINT32 n = (UNITY_ARRAY_SCRATCH_SLOTS * 2) + 4;
+    UNITY_UINT32 i;
+
+    for (i = 0; i < n; i++)
+    {
+        forward[i]  = (UNITY_UINT16)(i / 2);
+        backward[i] = (UNITY_UINT16)((n - 1 - i) / 2);
+    }
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_UINT16_ARRAY_PERMUTATION(forward, backward, n);
+    VERIFY_FAILS_END
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_UINT16_ARRAY_SUBSET(forward, backward, n, n / 2);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testIntArrayPermutationLargerThanCallerScratchFallsBack(void)
+{
+    /* A caller's table too small for the array asks for the fallback that needs none */
+    UNITY_ARRAY_SCRATCH_T scratch[1];
+    UNITY_UINT16 forward[(UNITY_ARRAY_SCRATCH_SLOTS * 2) + 4];
+    UNITY_UINT16 backward[(UNITY_ARRAY_SCRATCH_SLOTS * 2) + 4];
+    const UNITY_UINT32 n = (UNITY_ARRAY_SCRATCH_SLOTS * 2) + 4;
+    UNITY_UINT32 i;
+
+    for (i = 0; i < n; i++)
+    {
+        forward[i]  = (UNITY_UINT16)(i / 2);
+        backward[i] = (UNITY_UINT16)((n - 1 - i) / 2);
+    }
+
+    TEST_ASSERT_UINT16_ARRAY_PERMUTATION_WITH_SCRATCH(forward, backward, n, scratch, 1);
+    TEST_ASSERT_UINT16_ARRAY_SUBSET_WITH_SCRATCH(forward, backward, n, n / 2, scratch, 1);
+
+    backward[n / 2] = backward[0];
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_UINT16_ARRAY_PERMUTATION_WITH_SCRATCH(forward, backward, n, scratch, 1);
+    VERIFY_FAILS_END
+}
+
+void testIntArrayPermutationWithCallerScratch(void)
+{
+    /* A table from the caller keeps arrays far larger than the static one on the hashed path */
+    UNITY_UINT16 forward[1000];
+    UNITY_UINT16 backward[1000];
+    UNITY_ARRAY_SCRATCH_T scratch[2048];
+    UNITY_UINT32 used = 0;
+    UNITY_UINT32 i;
+
+    for (i = 0; i < 1000; i++)
+    {
+        forward[i]  = (UNITY_UINT16)(i / 2);
+        backward[i] = (UNITY_UINT16)((999 - i) / 2);
+    }
+    for (i = 0; i < 2048; i++)
+    {
+        scratch[i].Index = 0;
+        scratch[i].Count = 0;
+    }
+
+    TEST_ASSERT_UINT16_ARRAY_PERMUTATION_WITH_SCRATCH(forward, backward, 1000, scratch, 2048);
+    for (i = 0; i < 2048; i++)
+    {
+        used += (scratch[i].Index != 0) ? 1 : 0;
+    }
+    TEST_ASSERT_EQUAL_UINT32(500, used);
+
+    TEST_ASSERT_UINT16_ARRAY_SUBSET_WITH_SCRATCH(forward, backward, 1000, 500, scratch, 2048);
+    TEST_ASSERT_UINT16_ARRAY_PERMUTATION_WITH_SCRATCH_MESSAGE(forward, backward, 1000, scratch, 2048, "Custom Message.");
+}
+
+void testIntArrayNotPermutationWithCallerScratch(void)
+{
+    UNITY_UINT16 forward[1000];
+    UNITY_UINT16 backward[1000];
+    UNITY_ARRAY_SCRATCH_T scratch[2048];
+    UNITY_UINT32 i;
+
+    for (i = 0; i < 1000; i++)
+    {
+        forward[i]  = (UNITY_UINT16)(i / 2);
+        backward[i] = (UNITY_UINT16)((999 - i) / 2);
+    }
+    backward[500] = backward[0];
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_UINT16_ARRAY_PERMUTATION_WITH_SCRATCH(forward, backward, 1000, scratch, 2048);
+    VERIFY_FAILS_END
+}
+
+void testIntArraySubsetWithTooSmallScratchFallsBack(void)
+{
+    int superset[] = {5, 4, 3, 3, 2, 1};
+    int p0[] = {3, 1, 3};
+    int p1[] = {3, 3, 3};
+    UNITY_ARRAY_SCRATCH_T scratch[4];
+
+    TEST_ASSERT_INT_ARRAY_SUBSET_WITH_SCRATCH(superset, p0, 6, 3, scratch, 4);
+    TEST_ASSERT_INT_ARRAY_SUBSET_WITH_SCRATCH(superset, p0, 6, 3, NULL, 0);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_SUBSET_WITH_SCRATCH(superset, p1, 6, 3, scratch, 4);
+    VERIFY_FAILS_END
+}
+
+void testIntArraySubset(void)
+{
+    int superset[] = {5, 4, 3, 3, 2, 1};
+    int p0[] = {3, 1, 3};
+    int p1[] = {5};
+
+    TEST_ASSERT_INT_ARRAY_SUBSET(superset, p0, 6, 3);
+    TEST_ASSERT_INT_ARRAY_SUBSET(superset, p1, 6, 1);
+    TEST_ASSERT_INT_ARRAY_SUBSET(superset, superset, 6, 6);
+    TEST_ASSERT_INT_ARRAY_SUBSET_MESSAGE(superset, p0, 6, 2, "Custom Message.");
+}
+
+void testIntArraySubsetOfNothing(void)
+{
+    int superset[] = {5, 4, 3};
+    int p0[] = {1};
+
+    TEST_ASSERT_INT_ARRAY_SUBSET(superset, p0, 3, 0);
+    TEST_ASSERT_STRING_ARRAY_SUBSET(NULL, NULL, 1, 0);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_SUBSET(superset, p0, 0, 0);
+    VERIFY_FAILS_END
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_SUBSET(superset, p0, 0, 1);
+    VERIFY_FAILS_END
+}
+
+void testIntArrayNotSubsetTooManyDuplicates(void)
+{
+    int superset[] = {5, 4, 3, 3, 2, 1};
+    int p0[] = {3, 3, 3};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_SUBSET(superset, p0, 6, 3);
+    VERIFY_FAILS_END
+}
+
+void testIntArrayNotSubsetLongerThanExpected(void)
+{
+    int superset[] = {1, 2};
+    int p0[] = {2, 1, 2};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_SUBSET(superset, p0, 2, 3);
+    VERIFY_FAILS_END
+}
+
+void testStringArrayPermutation(void)
+{
+    const char* p0[] = {"foo", "boo", NULL, "foo", ""};
+    const char* p1[] = {"", "foo", "foo", "boo", NULL};
+
+    TEST_ASSERT_STRING_ARRAY_PERMUTATION(p0, p1, 5);
+    TEST_ASSERT_STRING_ARRAY_SUBSET(p0, p1, 5, 3);
+}
+
+void testStringArrayPermutationWithCallerScratch(void)
+{
+    const char* p0[] = {"foo", "boo", NULL, "foo", ""};
+    const char* p1[] = {"", "foo", "foo", "boo", NULL};
+    const char* p2[] = {"", "foo", "boo", "boo", NULL};
+    UNITY_ARRAY_SCRATCH_T scratch[16];
+
+    TEST_ASSERT_STRING_ARRAY_PERMUTATION_WITH_SCRATCH(p0, p1, 5, scratch, 16);
+    TEST_ASSERT_STRING_ARRAY_SUBSET_WITH_SCRATCH_MESSAGE(p0, p1, 5, 3, scratch, 16, "Custom Message.");
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_ARRAY_PERMUTATION_WITH_SCRATCH(p0, p2, 5, scratch, 16);
+    VERIFY_FAILS_END
+}
+
+void testStringArrayNotPermutation(void)
+{
+    const char* p0[] = {"foo", "boo", "woo", "moo"};
+    const char* p1[] = {"moo", "woo", "boo", "fo"};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_ARRAY_PERMUTATION(p0, p1, 4);
+    VERIFY_FAILS_END
+}
+
+void testStringArrayNotPermutationNullElement(void)
+{
+    const char* p0[] = {"foo", "boo", "woo", "moo"};
+    const char* p1[] = {"moo", "woo", "boo", NULL};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_ARRAY_PERMUTATION(p0, p1, 4);
+    VERIFY_FAILS_END
+}
+
+void testStringArrayNotSubset(void)
+{
+    const char* p0[] = {"foo", "boo", "woo", "moo"};
+    const char* p1[] = {"boo", "zoo"};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_ARRAY_SUBSET_MESSAGE(p0, p1, 4, 2, "Custom Message.");
+    VERIFY_FAILS_END
+}
+
+void testIntArraySorted(void)
+{
+    int p0[] = {-987, 1, 8, 8, 65132};
+    UNITY_UINT8 p1[] = {0, 1, 127, 128, 255};
+    UNITY_INT8 p2[] = {-128, -1, 0, 127};
+
+    TEST_ASSERT_INT_ARRAY_SORTED(p0, 5);
+    TEST_ASSERT_INT_ARRAY_SORTED(p0, 1);
+    TEST_ASSERT_UINT8_ARRAY_SORTED(p1, 5);
+    TEST_ASSERT_HEX8_ARRAY_SORTED(p1, 5);
+    TEST_ASSERT_INT8_ARRAY_SORTED_MESSAGE(p2, 4, "Custom Message.");
+}
+
+void testIntArrayNotSorted(void)
+{
+    int p0[] = {-987, 1, 8, 7, 65132};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_SORTED(p0, 5);
+    VERIFY_FAILS_END
+}
+
+void testUIntArrayNotSortedAsSigned(void)
+{
+    UNITY_UINT8 p0[] = {0, 1, 127, 128, 255};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT8_ARRAY_SORTED(p0, 5);
+    VERIFY_FAILS_END
+}
+
+void testUInt32ArrayNotSorted(void)
+{
+    UNITY_UINT32 p0[] = {1, 0x80000000, 2};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_UINT32_ARRAY_SORTED(p0, 3);
+    VERIFY_FAILS_END
+}
+
+void testIntArraySortedNullActual(void)
+{
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_INT_ARRAY_SORTED(NULL, 3);
+    VERIFY_FAILS_END
+}
+
+void testStringArraySorted(void)
+{
+    const char* p0[] = {NULL, "", "boo", "foo", "foo", "fool"};
+
+    TEST_ASSERT_STRING_ARRAY_SORTED(p0, 6);
+}
+
+void testStringArrayNotSorted(void)
+{
+    const char* p0[] = {"boo", "fool", "foo"};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_ARRAY_SORTED(p0, 3);
+    VERIFY_FAILS_END
+}
+
+void testStringArrayNotSortedNullAfterString(void)
+{
+    const char* p0[] = {"boo", NULL};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_STRING_ARRAY_SORTED(p0, 2);
+    VERIFY_FAILS_END
+}
+
+void testEqualIntEachEqual(void)
+{
+    int p0[] = {1, 1, 1, 1};
+    int p1[] = {987, 987, 987, 987};
+    int p2[] = {-2, -2, -2, -3};
+    int p3[] = {1, 5, 600, 700};
+
+    TEST_ASSERT_EACH_EQUAL_INT(1, p0, 1);
+    TEST_ASSERT_EACH_EQUAL_INT(1, p0, 4);
+    TEST_ASSERT_EACH_EQUAL_INT(987, p1, 4);
+    TEST_ASSERT_EACH_EQUAL_INT(-2, p2, 3);
+    TEST_ASSERT_EACH_EQUAL_INT(1, p3, 1);
+}
+
+void testNotEqualIntEachEqualNullActual(void)
+{
+    int* p1 = NULL;
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EACH_EQUAL_INT(1, p1, 4);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualIntEachEqual1(void)
 {
     int p0[] = {1, 1, 1, -2};
 
@@ -7036,6 +8357,57 @@ void testNotEqualFloatArraysLengthZero(void)
 #endif
 }
 
+struct StridedFloatPoint
+{
+    int id;
+    float x;
+    float y;
+};
+
+void testEqualFloatArraysStrided(void)
+{
+#ifdef UNITY_EXCLUDE_FLOAT
+    TEST_IGNORE();
+#else
+    struct StridedFloatPoint points[3] = {{1, 1.0f, -8.0f}, {2, 25.4f, -0.123f}, {3, 0.5f, 2.25f}};
+    float xs[] = {1.0f, 25.4f, 0.5f};
+    float ys[] = {-8.0f, -0.123f, 2.25f};
+
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED(xs, points, sizeof(points[0]), offsetof(struct StridedFloatPoint, x), 3);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED(ys, &points[0].y, sizeof(points[0]), 0, 3);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED(xs, xs, 0, 0, 3);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED(NULL, NULL, sizeof(points[0]), 0, 1);
+#endif
+}
+
+void testNotEqualFloatArraysStrided(void)
+{
+#ifdef UNITY_EXCLUDE_FLOAT
+    TEST_IGNORE();
+#else
+    struct StridedFloatPoint points[3] = {{1, 1.0f, -8.0f}, {2, 25.4f, -0.123f}, {3, 0.5f, 2.25f}};
+    float ys[] = {-8.0f, -0.2f, 2.25f};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED(ys, &points[0].y, sizeof(points[0]), 0, 3);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testNotEqualFloatArraysStridedLengthZero(void)
+{
+#ifdef UNITY_EXCLUDE_FLOAT
+    TEST_IGNORE();
+#else
+    float p0[1] = {0.0f};
+    float p1[2] = {0.0f, 0.0f};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY_STRIDED(p0, p1, 2 * sizeof(float), 0, 0);
+    VERIFY_FAILS_END
+#endif
+}
+
 void testEqualFloatEachEqual(void)
 {
 #ifdef UNITY_EXCLUDE_FLOAT
@@ -7894,6 +9266,57 @@ void testNotEqualDoubleArraysLengthZero(void)
 #endif
 }
 
+struct StridedDoublePoint
+{
+    int id;
+    double x;
+    double y;
+};
+
+void testEqualDoubleArraysStrided(void)
+{
+#ifdef UNITY_EXCLUDE_DOUBLE
+    TEST_IGNORE();
+#else
+    struct StridedDoublePoint points[3] = {{1, 1.0, -8.0}, {2, 25.4, -0.123}, {3, 0.5, 2.25}};
+    double xs[] = {1.0, 25.4, 0.5};
+    double ys[] = {-8.0, -0.123, 2.25};
+
+    TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED(xs, points, sizeof(points[0]), offsetof(struct StridedDoublePoint, x), 3);
+    TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED(ys, &points[0].y, sizeof(points[0]), 0, 3);
+    TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED(xs, xs, 0, 0, 3);
+    TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED(NULL, NULL, sizeof(points[0]), 0, 1);
+#endif
+}
+
+void testNotEqualDoubleArraysStrided(void)
+{
+#ifdef UNITY_EXCLUDE_DOUBLE
+    TEST_IGNORE();
+#else
+    struct StridedDoublePoint points[3] = {{1, 1.0, -8.0}, {2, 25.4, -0.123}, {3, 0.5, 2.25}};
+    double ys[] = {-8.0, -0.2, 2.25};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED(ys, &points[0].y, sizeof(points[0]), 0, 3);
+    VERIFY_FAILS_END
+#endif
+}
+
+void testNotEqualDoubleArraysStridedLengthZero(void)
+{
+#ifdef UNITY_EXCLUDE_DOUBLE
+    TEST_IGNORE();
+#else
+    double p0[1] = {0.0};
+    double p1[2] = {0.0, 0.0};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_DOUBLE_ARRAY_STRIDED(p0, p1, 2 * sizeof(double), 0, 0);
+    VERIFY_FAILS_END
+#endif
+}
+
 void testEqualDoubleEachEqual(void)
 {
 #ifdef UNITY_EXCLUDE_DOUBLE